@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: cycle_profiler.cpp                    //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstring>
+
+#include "./cycle_profiler.h"
+
+CYCLE_PROFILER::CYCLE_PROFILER()
+{
+    budget = 0;
+    Reset();
+}
+
+void CYCLE_PROFILER::StartSysTick()
+{
+    systick_hw->csr = 0;
+    systick_hw->rvr = 0x00ffffff;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x05;     // Enable, processor clock, no interrupt
+}
+
+void CYCLE_PROFILER::Reset()
+{
+    min = 0xffffffff;
+    max = 0;
+    sum = 0;
+    count = 0;
+    overruns = 0;
+    ring_pos = 0;
+    max_is_new = false;
+
+    memset(histogram, 0, sizeof(histogram));
+    memset(ring, 0, sizeof(ring));
+    memset(max_registers, 0, sizeof(max_registers));
+}
+
+void CYCLE_PROFILER::Print(const char *name)
+{
+    // Snapshot, the other core keeps on counting
+    uint32_t c = count;
+    uint64_t s = sum;
+    uint32_t mi = min;
+    uint32_t ma = max;
+    uint32_t o = overruns;
+
+    printf("\n-%s-\n", name);
+
+    if (c == 0)
+    {
+        printf("no calls\n");
+        return;
+    }
+
+    printf("calls: %lu\n", (unsigned long)c);
+    printf("cycles min/mean/max: %lu / %lu / %lu\n", (unsigned long)mi, (unsigned long)(s / c), (unsigned long)ma);
+
+    if (budget)
+    {
+        printf("budget: %lu cycles, max load: %lu%%, mean load: %lu%%, overruns: %lu\n",
+               (unsigned long)budget,
+               (unsigned long)(ma * 100 / budget),
+               (unsigned long)(s / c * 100 / budget),
+               (unsigned long)o);
+    }
+
+    for (int i = 0; i < PROFILER_BUCKETS; i++)
+    {
+        if (histogram[i] == 0)
+            continue;
+
+        uint32_t from = i << PROFILER_BUCKET_SHIFT;
+        if (i == PROFILER_BUCKETS - 1)
+            printf("%5lu-     : %lu\n", (unsigned long)from, (unsigned long)histogram[i]);
+        else
+            printf("%5lu-%5lu: %lu\n", (unsigned long)from, (unsigned long)(from + (1 << PROFILER_BUCKET_SHIFT) - 1), (unsigned long)histogram[i]);
+    }
+
+    printf("registers at max:");
+    for (int i = 0; i < 0x19; i++)
+    {
+        if ((i & 7) == 0)
+            printf("\n $%02x:", i);
+        printf(" %02x", max_registers[i]);
+    }
+    printf("\n");
+}
+
+void CYCLE_PROFILER::PrintRing(const char *name)
+{
+    printf("\n-%s last %d calls-\n", name, PROFILER_RING_SIZE);
+
+    uint32_t pos = ring_pos;
+    for (int i = 0; i < PROFILER_RING_SIZE; i++)
+    {
+        printf("%5u", ring[(pos + i) & (PROFILER_RING_SIZE - 1)]);
+        if ((i & 15) == 15)
+            printf("\n");
+    }
+}
@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: cycle_profiler.h                      //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+#ifndef CYCLE_PROFILER_CLASS_H
+#define CYCLE_PROFILER_CLASS_H
+
+#include <stdint.h>
+#include <hardware/structs/systick.h>
+
+#include "./pico_sid_defs.h"
+
+// Histogram bucket width is 1 << PROFILER_BUCKET_SHIFT cycles,
+// the last bucket also counts everything above.
+#define PROFILER_BUCKET_SHIFT 9
+#define PROFILER_BUCKETS 16
+
+// Ring with the cycles of the last calls
+#define PROFILER_RING_SIZE 256
+
+class CYCLE_PROFILER
+{
+public:
+    CYCLE_PROFILER();
+
+    // SysTick counts down with the processor clock, every core has its own.
+    // Must be called once on each core that uses a profiler.
+    static void StartSysTick();
+    static uint32_t Now();
+
+    void Reset();
+    void Add(uint32_t start, uint32_t end);
+    void SetSnapshot(const reg8 *registers, int count);
+
+    void Print(const char *name);
+    void PrintRing(const char *name);
+
+    volatile uint32_t min;
+    volatile uint32_t max;
+    volatile uint64_t sum;
+    volatile uint32_t count;
+    volatile uint32_t overruns;
+
+    // Cycles available per call, 0 = no limit
+    uint32_t budget;
+
+    uint32_t histogram[PROFILER_BUCKETS];
+    uint16_t ring[PROFILER_RING_SIZE];
+    uint32_t ring_pos;
+
+    // Register state at the slowest call
+    bool    max_is_new;
+    uint8_t max_registers[0x20];
+};
+
+inline uint32_t CYCLE_PROFILER::Now()
+{
+    return systick_hw->cvr;
+}
+
+inline void CYCLE_PROFILER::Add(uint32_t start, uint32_t end)
+{
+    // 24 bit down counter
+    uint32_t cycles = (start - end) & 0x00ffffff;
+
+    if (cycles < min)
+        min = cycles;
+    if (cycles > max)
+    {
+        max = cycles;
+        max_is_new = true;
+    }
+
+    sum += cycles;
+    count++;
+
+    if (budget && cycles > budget)
+        overruns++;
+
+    uint32_t bucket = cycles >> PROFILER_BUCKET_SHIFT;
+    if (bucket >= PROFILER_BUCKETS)
+        bucket = PROFILER_BUCKETS - 1;
+    histogram[bucket]++;
+
+    ring[ring_pos] = cycles > 0xffff ? 0xffff : cycles;
+    ring_pos = (ring_pos + 1) & (PROFILER_RING_SIZE - 1);
+}
+
+inline void CYCLE_PROFILER::SetSnapshot(const reg8 *registers, int count)
+{
+    if (!max_is_new)
+        return;
+
+    for (int i = 0; i < count && i < 0x20; i++)
+        max_registers[i] = registers[i];
+
+    max_is_new = false;
+}
+
+#endif // CYCLE_PROFILER_CLASS_H
@@ -13,6 +13,35 @@
 
 #define SYSTEM_CLOCK 270000		// ThePicoSid Prototype 2 runs withe 300MHz
 
+// Build options (can be set in CMakeLists.txt)
+#ifndef PROFILE_CYCLES
+#define PROFILE_CYCLES 0		// 1 = Measure the cycles of pwm_irq_handle and WriteSidReg, output over UART
+#endif
+#ifndef PWM_DMA_AUDIO
+#define PWM_DMA_AUDIO 0			// 1 = Core 1 renders half buffers, DMA feeds the PWM level (no IRQ per sample)
+#endif
+#ifndef BUS_DMA_CAPTURE
+#define BUS_DMA_CAPTURE 0		// 1 = DMA drains the write FIFO into the bus queue (no IRQ per write)
+#endif
+#ifndef SID_COUNT
+#define SID_COUNT 1				// 2 = Second SID at $D420, A5 on A5_PIN
+#endif
+#ifndef SID_STEREO
+#define SID_STEREO 0			// 1 = Second SID on AUDIO2_PIN, else both are mixed on AUDIO_PIN
+#endif
+#ifndef SID_CYCLE_EXACT
+#define SID_CYCLE_EXACT 0		// 1 = Every SID cycle with PICO_SID::ClockCycle (all pipelines), needs SPLIT_CORES
+#endif
+#ifndef SPLIT_CORES
+#define SPLIT_CORES SID_CYCLE_EXACT	// 1 = Core 0 clocks the voices, core 1 the filters and the audio output
+#endif
+#ifndef SID_RESAMPLER_MODE
+#define SID_RESAMPLER_MODE 0	// 1 = Fast, 2 = FIR: bandlimited decimation of the 4 steps of 6 cycles per sample
+#endif
+#ifndef PWM_NOISE_SHAPING
+#define PWM_NOISE_SHAPING 0		// 1 = 7 bit PWM at 16 x the sample rate with noise shaping, needs PWM_DMA_AUDIO
+#endif
+
 #include <cstdio>
 #include <malloc.h>
 #include <cstring>
@@ -26,15 +55,42 @@
 #include <hardware/pwm.h>
 #include <hardware/adc.h>
 #include <hardware/flash.h>
+#include <hardware/sync.h>
 
 #include "write_sid_reg.pio.h"
 #include "read_sid_reg.pio.h"
 #include "dma_read.pio.h"
+#include "paddle.pio.h"
 
 #include "pico_sid.h"
+#include "sid_bus_queue.h"
+
+#if SPLIT_CORES
+// Core 1 takes a half buffer of frames at once in DMA mode
+#if PWM_DMA_AUDIO
+#define SID_FRAME_QUEUE_SIZE 64
+#else
+#define SID_FRAME_QUEUE_SIZE 8
+#endif
+#include "sid_frame_queue.h"
+
+// SRAM (264 KB) left for the frame queue: the heap needs the merged and the
+// copied wave tables of two models during a model switch (2 x 64 KB),
+// ~48 KB are the hot path, the stacks and the other buffers
+#define SID_FRAME_QUEUE_MAX_SIZE ((264 - 2 * 64 - 48) * 1024)
+static_assert(sizeof(SID_FRAME_QUEUE) <= SID_FRAME_QUEUE_MAX_SIZE, "The SID frame queue does not fit in SRAM");
+#endif
+
+#if PWM_NOISE_SHAPING
+#include "pwm_noise_shaper.h"
+#endif
 
 #include "version.h"
 
+#if PROFILE_CYCLES
+#include "cycle_profiler.h"
+#endif
+
 // PIN MAPPING
 #define RES_PIN 2
 #define CLK_PIN 3		// Atention: When change this gpio, then also change this in write_sid_reg.pio
@@ -43,6 +99,8 @@
 #define ADRR_PIN 6
 #define DATA_PIN 11
 #define AUDIO_PIN 28
+#define A5_PIN 22		// Only with SID_COUNT 2
+#define AUDIO2_PIN 27	// Only with SID_STEREO
 #define ADC0_COMPARE_PIN 19
 #define ADC1_COMPARE_PIN 20
 #define ADC_2KHz_PIN 21
@@ -51,6 +109,69 @@
 
 #define ADC_OFFSET -9	// OLD -5
 
+// Paddles, 2 MHz PIO and PWM clock: one count per µs, 2KHz = 1024 PWM counts
+#define PADDLE_CLOCK_DIV (SYSTEM_CLOCK / 2000)
+#define PADDLE_PWM_WRAP 1023
+
+// PWM Audio 11Bit, clock divider 3 + 9/16
+// Noise shaping: 7Bit with 16 PWM periods per audio sample (~20 dB less noise up to 20 kHz than 11Bit)
+#if PWM_NOISE_SHAPING
+#define PWM_OVERSAMPLING 16
+#define PWM_BITS 7
+#else
+#define PWM_OVERSAMPLING 1
+#define PWM_BITS 11
+#endif
+#define PWM_WRAP ((1 << PWM_BITS) - 1)
+#define PWM_WRAP_CYCLES ((PWM_WRAP + 1) * PWM_OVERSAMPLING * 57 / 16)	// System clock cycles per audio sample
+
+// PWM DMA Audio, samples per half buffer
+#define PWM_DMA_BLOCK_SAMPLES 32
+
+// Bus writes are applied this many cycles after they happened on the bus,
+// core 1 renders one half buffer ahead in DMA mode
+#if PWM_DMA_AUDIO
+#define BUS_QUEUE_LATENCY (PWM_DMA_BLOCK_SAMPLES * 2 * 24)
+#else
+#define BUS_QUEUE_LATENCY (4 * 24)
+#endif
+#define BUS_WRITES_PER_SAMPLE 16
+
+// Clocking step of the SIDs, 1 = cycle exact
+#if SID_CYCLE_EXACT
+#define SID_CLOCK_DELTA_T 1
+#else
+#define SID_CLOCK_DELTA_T 6
+#endif
+
+// Resampler steps per sample, the SID_FRAME segments end at the steps
+#define SID_RESAMPLER_DECIMATION 4
+
+#define AUDIO_SAMPLE_RATE (SYSTEM_CLOCK * 1000.0 / PWM_WRAP_CYCLES)
+#define RESAMPLER_PASS_FREQ (AUDIO_SAMPLE_RATE * 0.4)	// ~100 taps with FIR
+
+#if SID_CYCLE_EXACT && !SPLIT_CORES
+#warning "SID_CYCLE_EXACT on one core does not run in real time"
+#endif
+
+#if SID_RESAMPLER_MODE && SID_CLOCK_DELTA_T > 24 / SID_RESAMPLER_DECIMATION
+#error "SID_CLOCK_DELTA_T is longer than a resampler step"
+#endif
+
+#if PWM_NOISE_SHAPING && !PWM_DMA_AUDIO
+#error "PWM_NOISE_SHAPING needs PWM_DMA_AUDIO (more than one PWM level per sample)"
+#endif
+
+#if SID_COUNT > 1 && SID_STEREO
+#define AUDIO_CHANNELS 2
+#else
+#define AUDIO_CHANNELS 1
+#endif
+
+#if SID_COUNT > 2
+#error "Only A5 is decoded, SID_COUNT can be 1 or 2"
+#endif
+
 volatile bool reset_state = true;
 
 volatile PIO pio;
@@ -59,15 +180,50 @@ volatile uint sm1;	// read sid
 volatile uint sm2;	// dma read
 
 volatile uint slice_num;
+#if AUDIO_CHANNELS > 1
+volatile uint slice_num2;
+#endif
 
 uint8_t* sid_io;
 
-PICO_SID sid;
+PICO_SID sid[SID_COUNT];	// sid[0] answers the reads
+SID_BUS_QUEUE bus_queue;	// Core 0 -> Core 1 (SPLIT_CORES: Core 0 only)
+volatile bool sid_reset_request = false;
+
+#if SPLIT_CORES
+SID_FRAME_QUEUE frame_queue;	// Voices of core 0 -> filters of core 1
+bool ProduceFrame();
+#endif
+
+#if PROFILE_CYCLES
+CYCLE_PROFILER profile_pwm_irq;		// Core 1
+CYCLE_PROFILER profile_write_reg;	// Core 0
+#endif
+
+#if PWM_DMA_AUDIO
+uint16_t pwm_dma_buffer[AUDIO_CHANNELS][2][PWM_DMA_BLOCK_SAMPLES * PWM_OVERSAMPLING] __attribute__((aligned(4)));
+uint pwm_dma_channel[AUDIO_CHANNELS][2];
+volatile bool pwm_dma_buffer_free[2] = {false, false};
+#endif
+
+#if PWM_NOISE_SHAPING
+PWM_NOISE_SHAPER noise_shaper[AUDIO_CHANNELS];	// Core 1
+#endif
 
 void InitPWMAudio(uint audio_out_gpio);
+void InitPWMDmaAudio(uint audio_out_gpio);
+void RenderAudio(int half);
 void DmaReadInit(PIO pio, uint sm, uint8_t* base_address);
+void PaddleInit();
+void PaddleDmaRestart();
+uint paddle_dma_channel[2];
+void BusDmaCaptureInit(PIO pio, uint sm);
+void BusConfigScan();
 uint8_t configuration[32];
 volatile bool config_is_new = false;
+volatile int config01_request = -1;	// Written by the IRQs of core 0, taken by ConfigUpdate
+volatile int config01_apply = -1;	// ConfigUpdate -> core 1, -1 = applied
+void ConfigUpdate();
 
 #define FLASH_CONFIG_OFFSET (256 * 1024)
 const uint8_t *flash_target_contents = (const uint8_t *)( XIP_BASE + FLASH_CONFIG_OFFSET );
@@ -80,7 +236,7 @@ void C64Reset(uint gpio, uint32_t events)
 	{
 		// C64 Reset
 		// Normalerweise erst wenn RESET 10 Zyklen auf Lo war
-        sid.Reset();
+        sid_reset_request = true;	// Core 1 does the reset (SPLIT_CORES: the voices on core 0)
     }
 	else if (events & GPIO_IRQ_EDGE_RISE) 
 	{
@@ -104,6 +260,86 @@ void WriteConfig()
 	sleep_ms(2);
 }
 
+// Same configuration for all SIDs, split by the core that clocks the part
+void SetConfig01Voices(uint8_t value)
+{
+	for(int i=0; i<SID_COUNT; i++)
+		sid[i].SetSidTypeVoices((value & 0x01) ? MOS_8580 : MOS_6581);
+}
+
+void SetConfig01Filters(uint8_t value)
+{
+	for(int i=0; i<SID_COUNT; i++)
+	{
+		sid[i].SetSidTypeFilters((value & 0x01) ? MOS_8580 : MOS_6581);
+		sid[i].EnableFilter(value & 0x02);
+		sid[i].EnableExtFilter(value & 0x04);
+		sid[i].EnableDigiBoost8580(value & 0x08);
+	}
+}
+
+void SetConfig01(uint8_t value)
+{
+	SetConfig01Voices(value);
+	SetConfig01Filters(value);
+}
+
+// Core 0 main loop. The IRQs only store a new configuration, the tables of
+// the model are built here and the SIDs are switched between two samples by
+// the core that clocks them (like sid_reset_request). The model that is no
+// longer used is freed after the switch.
+void ConfigUpdate()
+{
+	static int free_model = -1;
+
+	if(config01_apply >= 0)
+		return;		// Core 1 has not switched yet
+
+	if(free_model >= 0)
+	{
+		SID_WAVE::ModelFree((sid_type)free_model);
+		free_model = -1;
+	}
+
+	uint32_t irq_state = save_and_disable_interrupts();
+	int value = config01_request;
+	config01_request = -1;
+	restore_interrupts(irq_state);
+
+	if(value < 0)
+		return;
+
+	sid_type type = (value & 0x01) ? MOS_8580 : MOS_6581;
+	SID_WAVE::ModelInit(type);
+
+#if SPLIT_CORES
+	// The voices are clocked by this core between two frames
+	SetConfig01Voices(value);
+#endif
+
+	__sync_synchronize();	// Tables before the request
+	config01_apply = value;
+
+	free_model = (type == MOS_6581) ? MOS_8580 : MOS_6581;
+}
+
+// Core 1, between two samples
+SID_TIME_CRITICAL_INLINE inline void ConfigApply()
+{
+	int value = config01_apply;
+	if(value < 0)
+		return;
+
+#if SPLIT_CORES
+	SetConfig01Filters(value);
+#else
+	SetConfig01(value);
+#endif
+
+	__sync_synchronize();
+	config01_apply = -1;
+}
+
 void ReadConfig()
 {
 	set_sys_clock_khz(125000, true);
@@ -121,14 +357,7 @@ void ReadConfig()
 	}
 	
 
-	uint8_t value = configuration[CONFIG_01];
-	if(value & 0x01)
-		sid.SetSidType(MOS_8580);
-	else	
-		sid.SetSidType(MOS_6581);
-	sid.EnableFilter(value & 0x02);
-	sid.EnableExtFilter(value & 0x04);
-	sid.EnableDigiBoost8580(value & 0x08);
+	config01_request = configuration[CONFIG_01];
 	
 	set_sys_clock_khz(SYSTEM_CLOCK, true);
 	sleep_ms(2);
@@ -136,30 +365,38 @@ void ReadConfig()
 
 void ConfigOutput()
 {
-	// Output Coniguration to Serial
+	// Output Coniguration to Serial (the requested one, core 1 switches later)
+	uint8_t config = configuration[CONFIG_01];
+
 	printf("\n-Configuration-\n");
-	if(sid.sid_model == MOS_6581)
+	if(!(config & 0x01))
 		printf("SID Model is: MOS-6581\n");
 	else
 		printf("SID Model is: MOS-8580\n");
 	
 	printf("Filter is: ");
-	if(sid.filter_enable)
+	if(config & 0x02)
 		printf("on\n");
 	else
 		printf("off\n");
 
 	printf("ExtFilter is: ");
-	if(sid.extfilter_enable)
+	if(config & 0x04)
 		printf("on\n");
 	else
 		printf("off\n");
 
 	printf("Digiboost 8580 is: ");
-	if(sid.digi_boost_enable)
+	if(config & 0x08)
 		printf("on\n");
 	else
 		printf("off\n");
+
+	printf("SIDs: %d", SID_COUNT);
+#if SID_COUNT > 1
+	printf(" (2nd at $D420, %s)", SID_STEREO ? "stereo" : "mixed");
+#endif
+	printf("\n");
 }
 
 void CheckConfig(uint8_t address, uint8_t value)
@@ -200,14 +437,7 @@ void CheckConfig(uint8_t address, uint8_t value)
 						break;
 
 					case 0x02: 	// Config01_Read
-						if(sid.sid_model == MOS_8580)
-							val |= 0x01;
-						if(sid.filter_enable)
-							val |= 0x02;
-						if(sid.extfilter_enable)
-							val |= 0x04;
-						if(sid.digi_boost_enable)
-							val |= 0x08;
+						val = configuration[CONFIG_01] & 0x0f;
 						sid_io[0x1d] = val;
 						break;
 
@@ -254,13 +484,7 @@ void CheckConfig(uint8_t address, uint8_t value)
 						configuration[CONFIG_01] = value;	// Config_1
 						config_is_new = true;
 
-						if(value & 0x01)
-							sid.SetSidType(MOS_8580);
-						else	
-						sid.SetSidType(MOS_6581);
-						sid.EnableFilter(value & 0x02);
-						sid.EnableExtFilter(value & 0x04);
-						sid.EnableDigiBoost8580(value & 0x08);
+						config01_request = value;	// Applied by ConfigUpdate / core 1
 
 						ConfigOutput();
 
@@ -288,30 +512,156 @@ void CheckConfig(uint8_t address, uint8_t value)
 	}
 }
 
-void WriteSidReg()
+SID_TIME_CRITICAL void WriteSidReg()
 {
+#if PROFILE_CYCLES
+	uint32_t profile_start = CYCLE_PROFILER::Now();
+#endif
+
 	if (pio0_hw->irq & 1) 
 	{
 		pio0_hw->irq = 1;
 
-		uint16_t incomming = pio->rxf[sm0];
-		uint8_t sid_reg = (incomming >> 2) & 0x1f;
+		uint32_t incomming = pio->rxf[sm0];
+		uint8_t sid_reg = BUS_ADDRESS(incomming);	// With A5, the config registers are those of the first SID
 		uint8_t sid_value = (incomming >> 7) & 0xff;
 
-		sid.WriteReg(sid_reg, sid_value);
+		bus_queue.Push(incomming);	// Core 1 writes it with the bus timestamp
 		CheckConfig(sid_reg, sid_value);
 	}
+
+#if PROFILE_CYCLES
+	profile_write_reg.Add(profile_start, CYCLE_PROFILER::Now());
+#endif
 }
 
+#if BUS_DMA_CAPTURE
+uint bus_dma_channel;
+
+SID_TIME_CRITICAL void bus_dma_irq_handle()
+{
+	// After 2^32 writes, start again
+	dma_channel_acknowledge_irq0(bus_dma_channel);
+	dma_channel_set_trans_count(bus_dma_channel, 0xffffffff, true);
+}
+
+void BusDmaCaptureInit(PIO pio, uint sm)
+{
+	// Copy every FIFO word of write_sid_reg into the ring of the bus queue
+	bus_dma_channel = dma_claim_unused_channel(true);
+
+	dma_channel_config config = dma_channel_get_default_config(bus_dma_channel);
+	channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+	channel_config_set_read_increment(&config, false);
+	channel_config_set_write_increment(&config, true);
+	channel_config_set_ring(&config, true, 10);		// 256 words (BUS_QUEUE_SIZE * 4 = 1 << 10)
+	channel_config_set_dreq(&config, pio_get_dreq(pio, sm, false));
+
+	dma_channel_configure(bus_dma_channel,
+						  &config,
+						  bus_queue.buffer,		// write to the ring
+						  &pio->rxf[sm],		// read from RX fifo
+						  0xffffffff,			// do many transfers
+						  false);				// start later
+
+	bus_queue.SetDmaRegisters(&dma_channel_hw_addr(bus_dma_channel)->write_addr, &dma_channel_hw_addr(bus_dma_channel)->transfer_count);
+
+	dma_channel_set_irq0_enabled(bus_dma_channel, true);
+	irq_set_exclusive_handler(DMA_IRQ_0, bus_dma_irq_handle);
+	irq_set_enabled(DMA_IRQ_0, true);
+
+	dma_channel_start(bus_dma_channel);
+}
+
+void BusConfigScan()
+{
+	// The config commands ($1d-$1f) are answered by core 0 as soon as possible,
+	// the SID writes are done by core 1
+	static uint32_t scan_pos = 0;
+	uint32_t head = bus_queue.Head();
+
+	while(scan_pos != head)
+	{
+		uint32_t incomming = bus_queue.buffer[scan_pos];
+		uint8_t sid_reg = BUS_ADDRESS(incomming);	// With A5, the config registers are those of the first SID
+		uint8_t sid_value = (incomming >> 7) & 0xff;
+
+		if(sid_reg >= 0x1d && sid_reg <= 0x1f)
+			CheckConfig(sid_reg, sid_value);
+
+		scan_pos = (scan_pos + 1) & (BUS_QUEUE_SIZE - 1);
+	}
+}
+#endif
+
+#if PROFILE_CYCLES
+void ProfileCommand()
+{
+	// p = print statistics, d = dump the last pwm_irq_handle cycles, c = clear
+	switch(getchar_timeout_us(0))
+	{
+		case 'p':
+#if PWM_DMA_AUDIO
+			profile_pwm_irq.Print("RenderAudio");
+#else
+			profile_pwm_irq.Print("pwm_irq_handle");
+#endif
+			profile_write_reg.Print("WriteSidReg");
+			break;
+		case 'd':
+#if PWM_DMA_AUDIO
+			profile_pwm_irq.PrintRing("RenderAudio");
+#else
+			profile_pwm_irq.PrintRing("pwm_irq_handle");
+#endif
+			break;
+		case 'c':
+			profile_pwm_irq.Reset();
+			profile_write_reg.Reset();
+			printf("Profile cleared\n");
+			break;
+	}
+}
+#endif
+
 void Core1Entry() 
 {
 	multicore_lockout_victim_init(); 	// wird benötigt um den core1 anhalten zu können von Core 0
 
+#if PROFILE_CYCLES
+	CYCLE_PROFILER::StartSysTick();
+#endif
+
+#if PWM_DMA_AUDIO
+	InitPWMDmaAudio(AUDIO_PIN);
+
+	while (1)
+	{
+		// Refill the half buffer the DMA has just played
+		for(int i=0; i<2; i++)
+		{
+			if(pwm_dma_buffer_free[i])
+			{
+				pwm_dma_buffer_free[i] = false;
+
+#if PROFILE_CYCLES
+				uint32_t profile_start = CYCLE_PROFILER::Now();
+#endif
+				RenderAudio(i);
+#if PROFILE_CYCLES
+				profile_pwm_irq.Add(profile_start, CYCLE_PROFILER::Now());
+				profile_pwm_irq.SetSnapshot(sid[0].sid_register, 0x19);
+#endif
+			}
+		}
+	}
+#else
 	InitPWMAudio(AUDIO_PIN);
 
 	while (1)
 	{
 	}
+#endif
 }
 
 void GetVersionNumber(uint8_t *major, uint8_t *minor, uint8_t *patch)
@@ -332,10 +682,16 @@ int main()
 	gpio_init(PICO_LED_PIN);
 	gpio_set_dir(PICO_LED_PIN, true);
 
-	// ADC
-	gpio_init(ADC_2KHz_PIN);
-	gpio_set_dir(ADC_2KHz_PIN, true);	// Output
+#if PROFILE_CYCLES
+	CYCLE_PROFILER::StartSysTick();
+#if PWM_DMA_AUDIO
+	profile_pwm_irq.budget = PWM_WRAP_CYCLES * PWM_DMA_BLOCK_SAMPLES;
+#else
+	profile_pwm_irq.budget = PWM_WRAP_CYCLES;
+#endif
+#endif
 
+	// ADC (the 2KHz signal comes from the PWM, see PaddleInit)
 	gpio_init(ADC0_COMPARE_PIN);
 	gpio_init(ADC1_COMPARE_PIN);
 
@@ -359,12 +715,24 @@ int main()
 	pio = pio0;
 
 	// PIO Write SID
+	bus_queue.Reset(BUS_QUEUE_LATENCY);
+
+#if SID_COUNT > 1
+	uint offset = pio_add_program(pio, &write_sid_reg_a5_program);
+	sm0 = pio_claim_unused_sm(pio, true);
+	write_sid_reg_a5_program_init(pio, sm0, offset, CLK_PIN, CS_PIN, A5_PIN);	// + A5
+#else
 	uint offset = pio_add_program(pio, &write_sid_reg_program);
 	sm0 = pio_claim_unused_sm(pio, true);
 	write_sid_reg_program_init(pio, sm0, offset, CLK_PIN, CS_PIN);	//CLK_PIN + RW_PIN + A0-A4 + D0-D7 all PIN Count is 15
+#endif
+#if BUS_DMA_CAPTURE
+	BusDmaCaptureInit(pio, sm0);
+#else
 	irq_set_exclusive_handler(PIO0_IRQ_0, WriteSidReg);
 	irq_set_enabled(PIO0_IRQ_0, true);
 	pio0_hw->inte0 = PIO_IRQ0_INTE_SM0_BITS;
+#endif
 
 	// PIO Read SID
 	offset = pio_add_program(pio, &read_sid_reg_program);
@@ -382,18 +750,22 @@ int main()
     gpio_set_dir(RES_PIN, GPIO_IN);
     gpio_set_irq_enabled_with_callback(RES_PIN, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true, &C64Reset);
 
+#if SID_RESAMPLER_MODE
+	// Before core 1 renders, the FIR is calculated in double
+	for(int i=0; i<SID_COUNT; i++)
+		sid[i].SetupResampler((resampler_mode)SID_RESAMPLER_MODE, 24, SID_RESAMPLER_DECIMATION, AUDIO_SAMPLE_RATE * 24, RESAMPLER_PASS_FREQ);
+	printf("Resampler: %d taps\n", sid[0].resampler.Taps());
+#endif
+
 	// Start Core#1 for SID Emualtion
 	multicore_launch_core1(Core1Entry);
 
 	volatile uint16_t counter;
-	volatile bool	adc0_compare_state;
-	volatile bool	adc0_compare_state_old;
-	volatile bool	adc1_compare_state;
-	volatile bool	adc1_compare_state_old;
 
 	for(int i=0; i<32; i++)
 	{
-		sid.WriteReg(i, 0);
+		for(int j=0; j<SID_COUNT; j++)
+			sid[j].WriteReg(i, 0);
 		sid_io[i] = 0;
 	}
 
@@ -403,94 +775,257 @@ int main()
 	// Output Coniguration to Serial
 	ConfigOutput();
 
+	// Paddles by PIO 1 and DMA, nothing to poll
+	PaddleInit();
+
 	gpio_put(PICO_LED_PIN, true);
 
     while (1)
     {
-		// ADC
+#if SPLIT_CORES
+		// Core 0 is free for the voices of the next samples
+		ProduceFrame();
+#else
 		sleep_us(1);
+#endif
 
 		counter++;
-		gpio_put(ADC_2KHz_PIN, counter & 0x100);	// Create 2KHz Signal for the mosfet
+		PaddleDmaRestart();
 
-		// AX
-		adc0_compare_state = gpio_get(ADC0_COMPARE_PIN);
-		if(adc0_compare_state && !adc0_compare_state_old)
-			sid_io[25] = (counter + ADC_OFFSET) & 0xff;
-		adc0_compare_state_old = adc0_compare_state;
+#if BUS_DMA_CAPTURE
+		BusConfigScan();
+#endif
 
-		// AY
-		adc1_compare_state = gpio_get(ADC1_COMPARE_PIN);
-		if(adc1_compare_state && !adc1_compare_state_old)
-			sid_io[26] = (counter + ADC_OFFSET) & 0xff;
-		adc1_compare_state_old = adc1_compare_state;
+		ConfigUpdate();
 
 		if(config_is_new)
 		{
 			config_is_new = false;
 			WriteConfig();
 		}
+
+#if PROFILE_CYCLES
+		if(counter == 0)
+			ProfileCommand();
+#endif
     }
 }
 
-void pwm_irq_handle()
+// Bus writes of the next audio sample (24 SID cycles) per SID
+inline void FetchSampleWrites(SID_WRITE writes[SID_COUNT][BUS_WRITES_PER_SAMPLE], int sid_count[SID_COUNT])
 {
-	pwm_clear_irq(slice_num);
+	int count = bus_queue.Fetch(writes[0], BUS_WRITES_PER_SAMPLE, 24);
 
-		for(int i=0; i<4; i++) 	// 300MHz // with extfilter enabled
-		{
-			sid.Clock(6);			
+#if SID_COUNT > 1
+	// A5 selects the SID, the order of the writes per SID is kept
+	SID_WRITE all_writes[BUS_WRITES_PER_SAMPLE];
+	memcpy(all_writes, writes[0], count * sizeof(SID_WRITE));
 
-			sid_io[0x1b] = sid.voice[2].wave.ReadOSC();
-			sid_io[0x1c] = sid.voice[2].envelope.ReadEnv();
-		}
+	sid_count[0] = sid_count[1] = 0;
+	for(int i=0; i<count; i++)
+	{
+		int j = all_writes[i].address >> 5;
+		writes[j][sid_count[j]] = all_writes[i];
+		writes[j][sid_count[j]++].address &= 0x1f;
+	}
+#else
+	sid_count[0] = count;
+#endif
+}
+
+#if SPLIT_CORES
+// Core 0: voices of the next audio sample into the frame queue, false = queue full
+SID_TIME_CRITICAL bool ProduceFrame()
+{
+	SID_FRAME* frame = frame_queue.Free();
+	if(!frame)
+		return false;
+
+	SID_WRITE writes[SID_COUNT][BUS_WRITES_PER_SAMPLE];
+	int sid_count[SID_COUNT];
+
+	bool reset = sid_reset_request;
+	if(reset)
+	{
+		sid_reset_request = false;
+		for(int i=0; i<SID_COUNT; i++)
+			sid[i].ResetVoices();
+	}
+
+	FetchSampleWrites(writes, sid_count);
+
+	for(int j=0; j<SID_COUNT; j++)
+	{
+		sid[j].ClockVoiceFrame<SID_CLOCK_DELTA_T, SID_CYCLE_EXACT>(24, writes[j], writes[j] + sid_count[j], &frame[j]);
+		frame[j].reset = reset;		// Core 1 resets the filters
+	}
+
+	// Once per sample instead of every 6 cycles
+	sid_io[0x1b] = sid[0].voice[2].wave.ReadOSC();
+	sid_io[0x1c] = sid[0].voice[2].envelope.ReadEnv();
+
+	frame_queue.Commit();
+	return true;
+}
+#endif
+
+// One audio sample (24 SID cycles) as PWM level per audio channel,
+// signed 16 bit with PWM_NOISE_SHAPING
+inline void RenderSample(int* out)
+{
+#if SPLIT_CORES
+	// Only the filters, the voices are done by core 0. Without a frame the last level is held.
+	ConfigApply();
+
+	const SID_FRAME* frame = frame_queue.Next();
+	if(frame)
+	{
+		for(int j=0; j<SID_COUNT; j++)
+			sid[j].ClockFilterFrame<SID_CLOCK_DELTA_T, SID_CYCLE_EXACT>(&frame[j]);
+		frame_queue.Release();
+	}
+#else
+	SID_WRITE writes[SID_COUNT][BUS_WRITES_PER_SAMPLE];
+	int sid_count[SID_COUNT];
+	const SID_WRITE* write[SID_COUNT];
+	const SID_WRITE* writes_end[SID_COUNT];
+	cycle_count cycle[SID_COUNT];
+
+	if(sid_reset_request)
+	{
+		sid_reset_request = false;
+		for(int i=0; i<SID_COUNT; i++)
+			sid[i].Reset();
+	}
+
+	ConfigApply();
+
+	FetchSampleWrites(writes, sid_count);
 
-	/*
-	if(sid.extfilter_enable)
+	for(int j=0; j<SID_COUNT; j++)
 	{
-		for(int i=0; i<4; i++) 	// 300MHz // with extfilter enabled
+		write[j] = writes[j];
+		writes_end[j] = writes[j] + sid_count[j];
+		cycle[j] = 0;
+	}
+
+	for(int i=0; i<4; i++) 	// 300MHz // with extfilter enabled
+	{
+		for(int j=0; j<SID_COUNT; j++)
 		{
-			sid.Clock(6);			
-			sid_io[0x1b] = sid.voice[2].wave.ReadOSC();
-			sid_io[0x1c] = sid.voice[2].envelope.ReadEnv();
+#if SID_CYCLE_EXACT
+			sid[j].ClockSampleCycles(cycle[j], cycle[j] + 6, write[j], writes_end[j]);
+#else
+			sid[j].ClockSample<6>(cycle[j], cycle[j] + 6, write[j], writes_end[j]);
+#endif
+#if SID_RESAMPLER_MODE
+			sid[j].resampler.Input(sid[j].AudioOut(16));
+#endif
 		}
+
+		sid_io[0x1b] = sid[0].voice[2].wave.ReadOSC();
+		sid_io[0x1c] = sid[0].voice[2].envelope.ReadEnv();
 	}
-	else
+#endif
+
+#if PWM_NOISE_SHAPING
+#if SID_COUNT > 1 && !SID_STEREO
+	out[0] = (sid[0].ResampledOut(16) + sid[1].ResampledOut(16)) >> 1;
+#else
+	for(int j=0; j<AUDIO_CHANNELS; j++)
+		out[j] = sid[j].ResampledOut(16);
+#endif
+#elif SID_COUNT > 1 && !SID_STEREO
+	out[0] = ((sid[0].ResampledOut(12) + sid[1].ResampledOut(12)) >> 2) + 1024;
+#else
+	for(int j=0; j<AUDIO_CHANNELS; j++)
+		out[j] = sid[j].ResampledOut(11) + 1024;
+#endif
+}
+
+#if PWM_DMA_AUDIO
+// Fills the half buffers of all audio channels
+SID_TIME_CRITICAL void RenderAudio(int half)
+{
+	int out[AUDIO_CHANNELS];
+
+	for(int i=0; i<PWM_DMA_BLOCK_SAMPLES; i++)
 	{
-		for(int i=0; i<6; i++) 	// 300MHz // with extfilter disabled
+		RenderSample(out);
+		for(int j=0; j<AUDIO_CHANNELS; j++)
 		{
-			sid.Clock(4);			
-			sid_io[0x1b] = sid.voice[2].wave.ReadOSC();
-			sid_io[0x1c] = sid.voice[2].envelope.ReadEnv();
+#if PWM_NOISE_SHAPING
+			// The sample is held over the PWM periods, the shaped error changes the levels
+			for(int k=0; k<PWM_OVERSAMPLING; k++)
+				pwm_dma_buffer[j][half][i * PWM_OVERSAMPLING + k] = noise_shaper[j].Quantize(out[j], PWM_BITS);
+#else
+			pwm_dma_buffer[j][half][i] = out[j];
+#endif
 		}
 	}
-	*/
-	
-	uint16_t out = sid.AudioOut(11) + 1024;
+}
+#endif
+
+SID_TIME_CRITICAL void pwm_irq_handle()
+{
+#if PROFILE_CYCLES
+	uint32_t profile_start = CYCLE_PROFILER::Now();
+#endif
+
+	pwm_clear_irq(slice_num);
 
-	pwm_set_gpio_level(AUDIO_PIN, out);
+	int out[AUDIO_CHANNELS];
+	RenderSample(out);
+
+	pwm_set_gpio_level(AUDIO_PIN, out[0]);
+#if AUDIO_CHANNELS > 1
+	pwm_set_gpio_level(AUDIO2_PIN, out[1]);
+#endif
+
+#if PROFILE_CYCLES
+	profile_pwm_irq.Add(profile_start, CYCLE_PROFILER::Now());
+	profile_pwm_irq.SetSnapshot(sid[0].sid_register, 0x19);
+#endif
 }
 
-void InitPWMAudio(uint audio_out_gpio)
+uint InitPWMSlice(uint audio_out_gpio)
 {
 	gpio_set_function(audio_out_gpio, GPIO_FUNC_PWM);
 	gpio_set_drive_strength(audio_out_gpio, GPIO_DRIVE_STRENGTH_2MA);
 
 	// Find out which PWM slice is connected to GPIO 2 (it's slice 1)
-	slice_num = pwm_gpio_to_slice_num(audio_out_gpio);
+	uint slice = pwm_gpio_to_slice_num(audio_out_gpio);
 
 	// Set pwm frequenz
-	//pwm_set_clkdiv_int_frac(slice_num, 2,15);	// PWM Frequency of 41223Hz when Systemclock is 248MHz.
-	pwm_set_clkdiv_int_frac(slice_num, 3, 9);	// PWM Frequency of 41118Hz when Systemclock is 300MHz.
+	//pwm_set_clkdiv_int_frac(slice, 2,15);	// PWM Frequency of 41223Hz when Systemclock is 248MHz.
+	pwm_set_clkdiv_int_frac(slice, 3, 9);	// PWM Frequency of 41118Hz when Systemclock is 300MHz.
 
 	// Set period of 4 cycles (0 to 3 inclusive)
-	pwm_set_wrap(slice_num, 0x07ff);	// 11Bit
+	pwm_set_wrap(slice, PWM_WRAP);	// 11Bit (7Bit with PWM_NOISE_SHAPING)
 
-	// Set channel A output high for one cycle before dropping
-	pwm_set_chan_level(slice_num, PWM_CHAN_A, 0x0400);
+	// Set output to the middle level
+	pwm_set_gpio_level(audio_out_gpio, (PWM_WRAP + 1) / 2);
+
+	return slice;
+}
 
-	// Set the PWM running
+void InitPWM(uint audio_out_gpio)
+{
+	slice_num = InitPWMSlice(audio_out_gpio);
+
+	// Set the PWM running, the slices of both channels in phase. Atomic set,
+	// the enable bits of the other slices (paddle PWM of core 0) are kept.
+#if AUDIO_CHANNELS > 1
+	slice_num2 = InitPWMSlice(AUDIO2_PIN);
+	hw_set_bits(&pwm_hw->en, (1u << slice_num) | (1u << slice_num2));
+#else
 	pwm_set_enabled(slice_num, true);
+#endif
+}
+
+void InitPWMAudio(uint audio_out_gpio)
+{
+	InitPWM(audio_out_gpio);
 
 	// IRQ Swt
 	pwm_clear_irq(slice_num);
@@ -499,12 +1034,135 @@ void InitPWMAudio(uint audio_out_gpio)
 	irq_set_enabled(PWM_IRQ_WRAP, true);
 }
 
+#if PWM_DMA_AUDIO
+SID_TIME_CRITICAL void pwm_dma_irq_handle()
+{
+	for(int j=0; j<AUDIO_CHANNELS; j++)
+	{
+		for(int i=0; i<2; i++)
+		{
+			if(dma_channel_get_irq1_status(pwm_dma_channel[j][i]))
+			{
+				dma_channel_acknowledge_irq1(pwm_dma_channel[j][i]);
+
+				// The other channel plays now, rewind this one for its next turn
+				dma_channel_set_read_addr(pwm_dma_channel[j][i], pwm_dma_buffer[j][i], false);
+				if(j == 0)
+					pwm_dma_buffer_free[i] = true;
+			}
+		}
+	}
+}
+
+void InitPWMDmaAudio(uint audio_out_gpio)
+{
+	InitPWM(audio_out_gpio);
+
+	// Two chained channels per audio channel, each one plays a half buffer and then starts the other.
+	// All are paced by the wrap of the first slice.
+	const uint audio_slice[2] = {slice_num,
+#if AUDIO_CHANNELS > 1
+		slice_num2
+#else
+		slice_num
+#endif
+	};
+
+	for(int j=0; j<AUDIO_CHANNELS; j++)
+	{
+		pwm_dma_channel[j][0] = dma_claim_unused_channel(true);
+		pwm_dma_channel[j][1] = dma_claim_unused_channel(true);
+
+		for(int i=0; i<2; i++)
+		{
+			dma_channel_config config = dma_channel_get_default_config(pwm_dma_channel[j][i]);
+			channel_config_set_transfer_data_size(&config, DMA_SIZE_16);	// Written to channel A and B of the slice
+			channel_config_set_read_increment(&config, true);
+			channel_config_set_write_increment(&config, false);
+			channel_config_set_dreq(&config, DREQ_PWM_WRAP0 + slice_num);
+			channel_config_set_chain_to(&config, pwm_dma_channel[j][i ^ 1]);
+
+			dma_channel_configure(pwm_dma_channel[j][i],
+								  &config,
+								  &pwm_hw->slice[audio_slice[j]].cc,	// write to PWM level
+								  pwm_dma_buffer[j][i],					// read from half buffer
+								  PWM_DMA_BLOCK_SAMPLES * PWM_OVERSAMPLING,
+								  false);								// start later
+
+			dma_channel_set_irq1_enabled(pwm_dma_channel[j][i], true);
+		}
+	}
+
+	RenderAudio(0);
+	RenderAudio(1);
+
+	// DMA IRQ 1 on core 1, DMA IRQ 0 stays free for core 0
+	irq_set_exclusive_handler(DMA_IRQ_1, pwm_dma_irq_handle);
+	irq_set_enabled(DMA_IRQ_1, true);
+
+	// Start all audio channels at once
+	uint32_t start_mask = 0;
+	for(int j=0; j<AUDIO_CHANNELS; j++)
+		start_mask |= 1u << pwm_dma_channel[j][0];
+	dma_start_channel_mask(start_mask);
+}
+#endif
+
+// Paddles (POTX / POTY): the PWM drives the 2KHz signal for the mosfet (256 µs
+// discharge high, 256 µs charge low), one state machine of PIO 1 per paddle
+// counts the µs of the charge up to the comparator edge and one DMA channel
+// copies each reading into sid_io[25] / sid_io[26].
+void PaddleInit()
+{
+	const uint compare_pin[2] = {ADC0_COMPARE_PIN, ADC1_COMPARE_PIN};
+
+	gpio_set_function(ADC_2KHz_PIN, GPIO_FUNC_PWM);
+	uint slice = pwm_gpio_to_slice_num(ADC_2KHz_PIN);
+	pwm_set_clkdiv_int_frac(slice, PADDLE_CLOCK_DIV, 0);
+	pwm_set_wrap(slice, PADDLE_PWM_WRAP);
+	pwm_set_gpio_level(ADC_2KHz_PIN, (PADDLE_PWM_WRAP + 1) / 2);
+
+	uint offset = pio_add_program(pio1, &paddle_program);
+
+	for(int i=0; i<2; i++)
+	{
+		uint sm = pio_claim_unused_sm(pio1, true);
+		paddle_program_init(pio1, sm, offset, ADC_2KHz_PIN, compare_pin[i], PADDLE_CLOCK_DIV, 255 - ADC_OFFSET);
+
+		paddle_dma_channel[i] = dma_claim_unused_channel(true);
+
+		dma_channel_config config = dma_channel_get_default_config(paddle_dma_channel[i]);
+		channel_config_set_transfer_data_size(&config, DMA_SIZE_8);		// Low byte of the reading
+		channel_config_set_read_increment(&config, false);
+		channel_config_set_write_increment(&config, false);
+		channel_config_set_dreq(&config, pio_get_dreq(pio1, sm, false));
+
+		dma_channel_configure(paddle_dma_channel[i],
+							  &config,
+							  &sid_io[25 + i],		// write to POTX / POTY
+							  &pio1->rxf[sm],		// read from RX fifo
+							  0xffffffff,			// do many transfers
+							  true);				// start now
+	}
+
+	pwm_set_enabled(slice, true);
+}
+
+void PaddleDmaRestart()
+{
+	// After 2^32 readings (24 days), start again
+	for(int i=0; i<2; i++)
+	{
+		if(!dma_channel_is_busy(paddle_dma_channel[i]))
+			dma_channel_set_trans_count(paddle_dma_channel[i], 0xffffffff, true);
+	}
+}
+
 // Set up DMA channels for handling reads
 void DmaReadInit(PIO pio, uint sm, uint8_t* base_address) 
 {
     // Read channel: copy requested byte to TX fifo (source address set by write channel below)
-    uint read_channel = 0;
-    dma_channel_claim(read_channel);
+    uint read_channel = dma_claim_unused_channel(true);
 
     dma_channel_config read_config = dma_channel_get_default_config(read_channel);
     channel_config_set_read_increment(&read_config, false);
@@ -520,8 +1178,7 @@ void DmaReadInit(PIO pio, uint sm, uint8_t* base_address)
                           false);        // start later
 
     // Write channel: copy address from RX fifo to the read channel's READ_ADDR_TRIGGER
-    uint write_channel =1;
-    dma_channel_claim(write_channel);
+    uint write_channel = dma_claim_unused_channel(true);
     dma_channel_config write_config = dma_channel_get_default_config(write_channel);
     channel_config_set_read_increment(&write_config, false);
     channel_config_set_write_increment(&write_config, false);
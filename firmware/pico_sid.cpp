@@ -21,9 +21,11 @@ PICO_SID::PICO_SID()
     voice[1].SetSyncSource(&voice[0]);
     voice[2].SetSyncSource(&voice[1]);
 
+	resampler_step = 0;
 	Reset();
 
     ext_in = 0;
+	scope_buffer = 0;
 	filter_enable = true;
 	extfilter_enable = true;
 	digi_boost_enable = false;
@@ -40,6 +42,12 @@ PICO_SID::~PICO_SID()
 {
 }
 
+void PICO_SID::ClassInit()
+{
+	SID_WAVE::ModelInit(MOS_6581);
+	SID_WAVE::ModelInit(MOS_8580);
+}
+
 uint8_t PICO_SID::ReadReg(uint8_t)
 {
     return 0;
@@ -51,12 +59,21 @@ void PICO_SID::Input(int sample)
 }
 
 void PICO_SID::SetSidType(sid_type type)
+{
+	SetSidTypeVoices(type);
+	SetSidTypeFilters(type);
+}
+
+void PICO_SID::SetSidTypeVoices(sid_type type)
 {
     sid_model = type;
 
     for (int i = 0; i < 3; i++)
         voice[i].SetSidType(type);
+}
 
+void PICO_SID::SetSidTypeFilters(sid_type type)
+{
     filter.SetSidType(type);
 	extfilter.SetSidType(type);
 
@@ -81,19 +98,137 @@ void PICO_SID::EnableDigiBoost8580(bool enable)
 	SetExtIn();
 }
 
+void PICO_SID::SetScopeBuffer(SID_SCOPE_BUFFER* scope)
+{
+	scope_buffer = scope;
+}
+
+SID_TIME_CRITICAL void PICO_SID::CaptureScope(int pos)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		scope_buffer->wave[i][pos] = voice[i].wave.Output();
+		scope_buffer->envelope[i][pos] = voice[i].envelope.Output();
+	}
+}
+
+SID_TIME_CRITICAL void PICO_SID::ApplyWrites(const SID_WRITE* writes, const SID_WRITE* writes_end)
+{
+	while (writes < writes_end)
+	{
+		WriteReg(writes->address, writes->value);
+		writes++;
+	}
+}
+
+SID_TIME_CRITICAL int PICO_SID::ClockBlock(cycle_count cycles_per_sample, cycle_count delta_t, short* buffer, int samples, const SID_WRITE* writes, int write_count)
+{
+	const SID_WRITE* writes_end = writes + write_count;
+	cycle_count cycle = 0;
+
+	for (int i = 0; i < samples; i++)
+	{
+		if (resampler_step)
+		{
+			ClockResampledSample(cycle, cycles_per_sample, delta_t, writes, writes_end);
+			buffer[i] = resampler.Output(16);
+		}
+		else
+		{
+			ClockSample(cycle, cycle + cycles_per_sample, delta_t, writes, writes_end);
+			buffer[i] = AudioOut(16);
+		}
+
+		if (scope_buffer)
+			CaptureScope(i);
+	}
+
+	ApplyWrites(writes, writes_end);
+
+	return cycle;
+}
+
+SID_TIME_CRITICAL int PICO_SID::ClockBlock(cycle_count cycles_per_sample, cycle_count delta_t, uint16_t* buffer, int samples, int bits, const SID_WRITE* writes, int write_count)
+{
+	const SID_WRITE* writes_end = writes + write_count;
+	const int offset = 1 << (bits - 1);
+	cycle_count cycle = 0;
+
+	for (int i = 0; i < samples; i++)
+	{
+		if (resampler_step)
+		{
+			ClockResampledSample(cycle, cycles_per_sample, delta_t, writes, writes_end);
+			buffer[i] = resampler.Output(bits) + offset;
+		}
+		else
+		{
+			ClockSample(cycle, cycle + cycles_per_sample, delta_t, writes, writes_end);
+			buffer[i] = AudioOut(bits) + offset;
+		}
+
+		if (scope_buffer)
+			CaptureScope(i);
+	}
+
+	ApplyWrites(writes, writes_end);
+
+	return cycle;
+}
+
+// The steps of a sample are cycles_per_sample / decimation, a rest is spread over the steps
+SID_TIME_CRITICAL void PICO_SID::ClockResampledSample(cycle_count& cycle, cycle_count cycles_per_sample, cycle_count delta_t, const SID_WRITE*& writes, const SID_WRITE* writes_end)
+{
+	const int decimation = resampler.Decimation();
+	const cycle_count sample_start = cycle;
+
+	for (int i = 1; i <= decimation; i++)
+	{
+		ClockSample(cycle, sample_start + cycles_per_sample * i / decimation, delta_t, writes, writes_end);
+		resampler.Input(AudioOut(16));
+	}
+}
+
+bool PICO_SID::SetupResampler(resampler_mode mode, cycle_count cycles_per_sample, int decimation, double clock_freq, double pass_freq)
+{
+	if (decimation > cycles_per_sample)
+		return false;
+
+	if (!resampler.Setup(mode, decimation, clock_freq * decimation / cycles_per_sample, pass_freq))
+		return false;
+
+	resampler_step = mode == RESAMPLER_OFF ? 0 : cycles_per_sample / decimation;
+	return true;
+}
+
 void PICO_SID::Reset()
+{
+    for(int i=0; i<0x20; i++)
+        sid_register[i] = 0;
+
+    ResetVoices();
+    ResetFilters();
+}
+
+void PICO_SID::ResetVoices()
 {
     for(int i=0; i<3; i++)
 	{
         voice[i].Reset();
 	}
+}
 
+void PICO_SID::ResetFilters()
+{
     filter.Reset();
 	extfilter.Reset();
+	resampler.Reset();
 }
 
-void PICO_SID::WriteReg(uint8_t write_address, uint8_t bus_value)
+SID_TIME_CRITICAL void PICO_SID::WriteReg(uint8_t write_address, uint8_t bus_value)
 {
+     sid_register[write_address & 0x1f] = bus_value;
+
      switch (write_address & 0x1f) {
      case 0x00:
          voice[0].wave.WriteFreqLo(bus_value);
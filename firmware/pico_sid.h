@@ -21,6 +21,46 @@
 #include "./sid_voice.h"
 #include "./sid_filter.h"
 #include "./sid_extfilter.h"
+#include "./sid_resampler.h"
+
+// Register write for ClockBlock, cycle is counted from the start of the block
+struct SID_WRITE
+{
+	cycle_count cycle;
+	reg8 address;
+	reg8 value;
+};
+
+// Optional per sample capture of the voices for the oscilloscope views
+struct SID_SCOPE_BUFFER
+{
+	unsigned short* wave[3];
+	unsigned short* envelope[3];
+};
+
+// Voice outputs of one sample for the filters. With SPLIT_CORES core 0 clocks
+// the voices into a frame (ClockVoiceFrame) and core 1 the filters from it
+// (ClockFilterFrame). A segment is delta_t cycles with the voice outputs
+// at their end, or a filter register write in between (delta_t 0).
+// The segments end at the resampler steps, input marks the step ends.
+#define SID_FRAME_SEGMENTS 40	// cycles / DELTA_T + 2 * writes, 24 x 1 cycle + 16 or 4 x 6 cycles + 2 x 16
+
+// 16 bytes, with PWM DMA the frame queue has 64 frames per SID
+struct SID_FRAME_SEGMENT
+{
+	uint8_t delta_t;
+	bool input;		// Resampler input after the segment
+	uint8_t address;
+	uint8_t value;
+	int voice[3];
+};
+
+struct SID_FRAME
+{
+	int count;
+	bool reset;		// Reset the filters before the segments
+	SID_FRAME_SEGMENT segment[SID_FRAME_SEGMENTS];
+};
 
 class PICO_SID
 {
@@ -28,13 +68,62 @@ public:
 	PICO_SID();
 	~PICO_SID();
 
+	// Builds the merged wave tables of both models at once, nothing is built
+	// lazily afterwards (the DAC, noise and cutoff tables are compile time constants).
+	// Call it before PICO_SIDs are used on several threads.
+	static void ClassInit();
+
 	void SetSidType(sid_type type);
+	// SPLIT_CORES: each core switches its own part
+	void SetSidTypeVoices(sid_type type);
+	void SetSidTypeFilters(sid_type type);
 	void EnableFilter(bool enable);
 	void EnableExtFilter(bool enable);
 	void EnableDigiBoost8580(bool enable);
 
     void Clock(cycle_count delta_t);
+	// Fixed delta_t, the filter steps are unrolled
+	template<cycle_count DELTA_T>
+	void Clock();
+	// Cycle exact: one cycle with all pipelines of the reSID single cycle clocking
+	// (pulse compare, noise shift, 8580 tri/saw output, envelope steps, combined
+	// waveform writebacks). A SID is clocked either this way or by delta_t from Reset() on.
+	void ClockCycle();
+
+	// Renders samples in one go, every sample is cycles_per_sample SID cycles
+	// clocked in steps of delta_t. The writes must be sorted by cycle, each one
+	// is applied exactly at its cycle, writes behind the block after the last sample.
+	// Returns the clocked cycles.
+	int ClockBlock(cycle_count cycles_per_sample, cycle_count delta_t, short* buffer, int samples, const SID_WRITE* writes = 0, int write_count = 0);
+	// Same with unsigned PWM levels of bits width (0 .. (1 << bits) - 1)
+	int ClockBlock(cycle_count cycles_per_sample, cycle_count delta_t, uint16_t* buffer, int samples, int bits, const SID_WRITE* writes = 0, int write_count = 0);
+	// Clocks from cycle to sample_end and applies the writes due up to there,
+	// writes is advanced behind the applied ones
+	void ClockSample(cycle_count& cycle, cycle_count sample_end, cycle_count delta_t, const SID_WRITE*& writes, const SID_WRITE* writes_end);
+	template<cycle_count DELTA_T>
+	void ClockSample(cycle_count& cycle, cycle_count sample_end, const SID_WRITE*& writes, const SID_WRITE* writes_end);
+	// Same with ClockCycle, the 8580 takes each write one cycle later
+	void ClockSampleCycles(cycle_count& cycle, cycle_count sample_end, const SID_WRITE*& writes, const SID_WRITE* writes_end);
+	void SetScopeBuffer(SID_SCOPE_BUFFER* scope);
+
+	// ClockSample split in the voices and the filters, for two cores.
+	// The frame of cycles is written by the voices and then read by the filters,
+	// with both in turn the output is the same as with ClockSample.
+	// CYCLE_EXACT (DELTA_T 1) is ClockSampleCycles. All writes have to be within the frame.
+	template<cycle_count DELTA_T, bool CYCLE_EXACT = false>
+	void ClockVoiceFrame(cycle_count cycles, const SID_WRITE* writes, const SID_WRITE* writes_end, SID_FRAME* frame);
+	template<cycle_count DELTA_T, bool CYCLE_EXACT = false>
+	void ClockFilterFrame(const SID_FRAME* frame);
+
+	// Bandlimited output: every sample is clocked in decimation steps, the audio
+	// output after each step goes into the resampler (ClockBlock, ClockFilterFrame).
+	// clock_freq is the SID clock, RESAMPLER_OFF takes the output of the last cycle.
+	bool SetupResampler(resampler_mode mode, cycle_count cycles_per_sample, int decimation, double clock_freq, double pass_freq);
+	int ResampledOut(int bits);
+
 	void Reset();
+	void ResetVoices();
+	void ResetFilters();
     void WriteReg(uint8_t write_address, uint8_t bus_value);
 	uint8_t ReadReg(uint8_t address);
     void Input(int sample);
@@ -46,6 +135,7 @@ public:
     SID_VOICE voice[3];
     SID_FILTER filter;
 	SID_EXTFILTER extfilter;
+	SID_RESAMPLER resampler;
 
     reg8 sid_register[0x20];
 
@@ -60,6 +150,16 @@ public:
 	int		digi_level[2][2];
 
     int     ext_in;
+
+private:
+	void ClockVoices(cycle_count delta_t);
+	void ClockVoicesCycle();
+	void ApplyWrites(const SID_WRITE* writes, const SID_WRITE* writes_end);
+	void CaptureScope(int pos);
+	void ClockResampledSample(cycle_count& cycle, cycle_count cycles_per_sample, cycle_count delta_t, const SID_WRITE*& writes, const SID_WRITE* writes_end);
+
+	SID_SCOPE_BUFFER* scope_buffer;
+	cycle_count resampler_step;		// Cycles per resampler input, 0 = off
 };
 
 inline int PICO_SID::AudioOut()
@@ -90,20 +190,23 @@ inline int PICO_SID::AudioOut(int bits)
   	return sample;
 }
 
+SID_TIME_CRITICAL_INLINE inline int PICO_SID::ResampledOut(int bits)
+{
+	if (resampler_step)
+		return resampler.Output(bits);
+
+	return AudioOut(bits);
+}
+
 inline void PICO_SID::SetExtIn()
 {
 	Input(digi_level[sid_model][digi_boost_enable]);
 }
 
-inline void PICO_SID::Clock(cycle_count delta_t)
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::ClockVoices(cycle_count delta_t)
 {
     int i;
 
-    if (unlikely(delta_t <= 0))
-    {
-        return;
-    }
-
     for (i = 0; i < 3; i++)
     {
         voice[i].envelope.Clock(delta_t);
@@ -120,15 +223,8 @@ inline void PICO_SID::Clock(cycle_count delta_t)
                 continue;
             }
 
-            reg16 freq = wave.freq;
-            reg24 accumulator = wave.accumulator;
-            reg24 delta_accumulator =
-                (accumulator & 0x800000 ? 0x1000000 : 0x800000) - accumulator;
-
-            cycle_count delta_t_next = delta_accumulator/freq;
-            if (likely(delta_accumulator%freq)) {
-                ++delta_t_next;
-            }
+            // Cached, no division per step
+            cycle_count delta_t_next = wave.MsbNextCycles();
 
             if (unlikely(delta_t_next < delta_t_min)) {
                 delta_t_min = delta_t_next;
@@ -150,6 +246,54 @@ inline void PICO_SID::Clock(cycle_count delta_t)
     {
         voice[i].wave.SetWaveformOutput(delta_t);
     }
+}
+
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::ClockVoicesCycle()
+{
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        voice[i].envelope.Clock();
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        voice[i].wave.Clock();
+    }
+
+    // Synchronize oscillators.
+    for (i = 0; i < 3; i++)
+    {
+        voice[i].wave.Synchronize();
+    }
+
+    // Calculate waveform output, pushes the pulse and 8580 tri/saw pipelines.
+    for (i = 0; i < 3; i++)
+    {
+        voice[i].wave.SetWaveformOutput();
+    }
+}
+
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::ClockCycle()
+{
+    ClockVoicesCycle();
+
+    // Clock filter.
+    filter.ClockCycle(voice[0].Output(), voice[1].Output(), voice[2].Output(), ext_in);
+
+    // Clock external filter.
+    extfilter.Clock<1>(filter.Output());
+}
+
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::Clock(cycle_count delta_t)
+{
+    if (unlikely(delta_t <= 0))
+    {
+        return;
+    }
+
+    ClockVoices(delta_t);
 
     // Clock filter.
     filter.Clock(delta_t, voice[0].Output(), voice[1].Output(), voice[2].Output(), ext_in);
@@ -158,4 +302,208 @@ inline void PICO_SID::Clock(cycle_count delta_t)
     extfilter.Clock(delta_t, filter.Output());
 }
 
+template<cycle_count DELTA_T>
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::Clock()
+{
+    ClockVoices(DELTA_T);
+
+    // Clock filter.
+    filter.Clock<DELTA_T>(voice[0].Output(), voice[1].Output(), voice[2].Output(), ext_in);
+
+    // Clock external filter.
+    extfilter.Clock<DELTA_T>(filter.Output());
+}
+
+template<cycle_count DELTA_T, bool CYCLE_EXACT>
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::ClockVoiceFrame(cycle_count cycles, const SID_WRITE* writes, const SID_WRITE* writes_end, SID_FRAME* frame)
+{
+	static_assert(!CYCLE_EXACT || DELTA_T == 1, "Cycle exact frames have 1 cycle steps");
+
+	SID_FRAME_SEGMENT* segment = frame->segment;
+	cycle_count cycle = 0;
+
+	// The 8580 takes the writes one cycle later (cycle exact only)
+	const cycle_count write_delay = CYCLE_EXACT && sid_model == MOS_8580 ? 1 : 0;
+
+	// Resampler steps as in ClockResampledSample, without resampler one step
+	const int decimation = resampler_step ? resampler.Decimation() : 1;
+	int step = 1;
+	cycle_count step_end = cycles / decimation;
+
+	frame->reset = false;
+
+	while (cycle <= cycles)
+	{
+		while (writes < writes_end && (writes->cycle + write_delay <= cycle || cycle == cycles))
+		{
+			reg8 address = writes->address & 0x1f;
+
+			if (address >= 0x15 && address <= 0x18)
+			{
+				// Filter, written by ClockFilterFrame
+				segment->delta_t = 0;
+				segment->address = address;
+				segment->value = writes->value;
+				segment++;
+			}
+			else
+				WriteReg(address, writes->value);
+			writes++;
+		}
+
+		if (cycle == cycles)
+			break;
+
+		// Clock up to the next write or the end of the step
+		cycle_count next = step_end;
+		if (writes < writes_end && writes->cycle + write_delay < next)
+			next = writes->cycle + write_delay;
+
+		while (next > cycle)
+		{
+			cycle_count delta_t = next - cycle >= DELTA_T ? DELTA_T : next - cycle;
+
+			if (CYCLE_EXACT)
+				ClockVoicesCycle();
+			else
+				ClockVoices(delta_t);
+
+			segment->delta_t = delta_t;
+			segment->input = false;
+			segment->voice[0] = voice[0].Output();
+			segment->voice[1] = voice[1].Output();
+			segment->voice[2] = voice[2].Output();
+			segment++;
+
+			cycle += delta_t;
+		}
+
+		if (cycle == step_end)
+		{
+			segment[-1].input = resampler_step != 0;
+			step++;
+			step_end = cycles * step / decimation;
+		}
+	}
+
+	frame->count = segment - frame->segment;
+}
+
+template<cycle_count DELTA_T, bool CYCLE_EXACT>
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::ClockFilterFrame(const SID_FRAME* frame)
+{
+	static_assert(!CYCLE_EXACT || DELTA_T == 1, "Cycle exact frames have 1 cycle steps");
+
+	if (frame->reset)
+		ResetFilters();
+
+	const SID_FRAME_SEGMENT* segment = frame->segment;
+	const SID_FRAME_SEGMENT* segment_end = segment + frame->count;
+
+	for (; segment < segment_end; segment++)
+	{
+		if (CYCLE_EXACT && segment->delta_t)
+		{
+			filter.ClockCycle(segment->voice[0], segment->voice[1], segment->voice[2], ext_in);
+			extfilter.Clock<1>(filter.Output());
+		}
+		else if (segment->delta_t == DELTA_T)
+		{
+			filter.Clock<DELTA_T>(segment->voice[0], segment->voice[1], segment->voice[2], ext_in);
+			extfilter.Clock<DELTA_T>(filter.Output());
+		}
+		else if (segment->delta_t)
+		{
+			filter.Clock(segment->delta_t, segment->voice[0], segment->voice[1], segment->voice[2], ext_in);
+			extfilter.Clock(segment->delta_t, filter.Output());
+		}
+		else
+		{
+			WriteReg(segment->address, segment->value);
+			continue;
+		}
+
+		if (segment->input)
+			resampler.Input(AudioOut(16));
+	}
+}
+
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::ClockSample(cycle_count& cycle, cycle_count sample_end, cycle_count delta_t, const SID_WRITE*& writes, const SID_WRITE* writes_end)
+{
+	while (cycle < sample_end)
+	{
+		while (writes < writes_end && writes->cycle <= cycle)
+		{
+			WriteReg(writes->address, writes->value);
+			writes++;
+		}
+
+		// Clock up to the next write or the end of the sample
+		cycle_count next = sample_end;
+		if (writes < writes_end && writes->cycle < next)
+			next = writes->cycle;
+
+		while (next - cycle > delta_t)
+		{
+			Clock(delta_t);
+			cycle += delta_t;
+		}
+
+		Clock(next - cycle);
+		cycle = next;
+	}
+}
+
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::ClockSampleCycles(cycle_count& cycle, cycle_count sample_end, const SID_WRITE*& writes, const SID_WRITE* writes_end)
+{
+	// The 8580 takes the writes one cycle later
+	const cycle_count write_delay = sid_model == MOS_8580 ? 1 : 0;
+
+	while (cycle < sample_end)
+	{
+		while (writes < writes_end && writes->cycle + write_delay <= cycle)
+		{
+			WriteReg(writes->address, writes->value);
+			writes++;
+		}
+
+		ClockCycle();
+		cycle++;
+	}
+
+	// Delayed writes of the last cycle, before the first cycle of the next sample
+	while (writes < writes_end && writes->cycle < sample_end)
+	{
+		WriteReg(writes->address, writes->value);
+		writes++;
+	}
+}
+
+template<cycle_count DELTA_T>
+SID_TIME_CRITICAL_INLINE inline void PICO_SID::ClockSample(cycle_count& cycle, cycle_count sample_end, const SID_WRITE*& writes, const SID_WRITE* writes_end)
+{
+	while (cycle < sample_end)
+	{
+		while (writes < writes_end && writes->cycle <= cycle)
+		{
+			WriteReg(writes->address, writes->value);
+			writes++;
+		}
+
+		// Clock up to the next write or the end of the sample
+		cycle_count next = sample_end;
+		if (writes < writes_end && writes->cycle < next)
+			next = writes->cycle;
+
+		while (next - cycle >= DELTA_T)
+		{
+			Clock<DELTA_T>();
+			cycle += DELTA_T;
+		}
+
+		Clock(next - cycle);
+		cycle = next;
+	}
+}
+
 #endif // PICO_SID_CLASS_H
@@ -17,6 +17,29 @@
 
 #define RESID_INLINE
 
+// Run the per sample path (Clock, register writes, audio IRQ) from SRAM
+// instead of flash (XIP), the tables are copied to SRAM as well
+#ifndef SID_HOT_PATH_IN_RAM
+#define SID_HOT_PATH_IN_RAM 0
+#endif
+
+// Copy the combined waveform tables of the used SID model from flash to SRAM
+#ifndef SID_WAVE_TABLES_IN_RAM
+#define SID_WAVE_TABLES_IN_RAM SID_HOT_PATH_IN_RAM
+#endif
+
+// .time_critical.* is placed in SRAM by the linker script of the Pico SDK,
+// inline functions need their own section (COMDAT)
+#if SID_HOT_PATH_IN_RAM
+#define SID_TIME_CRITICAL __attribute__((section(".time_critical.pico_sid")))
+#define SID_TIME_CRITICAL_INLINE __attribute__((section(".time_critical.pico_sid_inline")))
+#define SID_TIME_CRITICAL_TABLE __attribute__((section(".time_critical.pico_sid_tables")))
+#else
+#define SID_TIME_CRITICAL
+#define SID_TIME_CRITICAL_INLINE
+#define SID_TIME_CRITICAL_TABLE
+#endif
+
 enum sid_type {MOS_6581, MOS_8580};
 
 typedef unsigned int reg4;
@@ -0,0 +1,75 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: pwm_noise_shaper.h                    //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+#ifndef PWM_NOISE_SHAPER_CLASS_H
+#define PWM_NOISE_SHAPER_CLASS_H
+
+#include <stdint.h>
+
+#include "./pico_sid_defs.h"
+
+// Quantizes 16 bit samples to the few bits of a fast PWM carrier.
+// 2nd order error feedback, the quantization error is fed back with
+// (1 - z^-1)^2: y = x + e - 2 * e[-1] + e[-2]. The noise moves from the
+// audio band up to the carrier rate, which the PWM runs a multiple of the
+// sample rate for (oversampling).
+
+class PWM_NOISE_SHAPER
+{
+public:
+	PWM_NOISE_SHAPER();
+
+	void Reset();
+
+	// Signed 16 bit in, PWM level 0 .. (1 << bits) - 1 out
+	int Quantize(int sample, int bits);
+
+private:
+	int error[2];	// Sample - PWM level of the last two calls (16 bit scale)
+};
+
+inline PWM_NOISE_SHAPER::PWM_NOISE_SHAPER()
+{
+	Reset();
+}
+
+inline void PWM_NOISE_SHAPER::Reset()
+{
+	error[0] = error[1] = 0;
+}
+
+SID_TIME_CRITICAL_INLINE inline int PWM_NOISE_SHAPER::Quantize(int sample, int bits)
+{
+	const int shift = 16 - bits;
+	const int half = 1 << (bits - 1);
+
+	int v = sample + 2 * error[0] - error[1];
+	int level = (v + (1 << (shift - 1))) >> shift;
+
+	if (level >= half)
+		level = half - 1;
+	else if (level < -half)
+		level = -half;
+
+	// Limited to one step, a clipped level would let the loop run away
+	int e = v - (level << shift);
+	if (e > (1 << shift))
+		e = 1 << shift;
+	else if (e < -(1 << shift))
+		e = -(1 << shift);
+
+	error[1] = error[0];
+	error[0] = e;
+
+	return level + half;
+}
+
+#endif // PWM_NOISE_SHAPER_CLASS_H
@@ -55,7 +55,7 @@ EOF
 print F "{\n";
 
 for (my $i = 0; $i < length($data); $i += 8) {
-  print F sprintf("/* 0x%03x: */ ", $i), map(sprintf(" 0x%03x,", $_ << 4), unpack("C*", substr($data, $i, 8))), "\n";
+  print F sprintf("/* 0x%03x: */ ", $i), map(sprintf(" 0x%02x,", $_), unpack("C*", substr($data, $i, 8))), "\n";
 }
 
 print F "},\n";
@@ -0,0 +1,230 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: sid_bus_queue.h                       //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+#ifndef SID_BUS_QUEUE_CLASS_H
+#define SID_BUS_QUEUE_CLASS_H
+
+#include <stdint.h>
+
+#include "./pico_sid.h"
+
+// Lock free single producer / single consumer ring with the raw FIFO words
+// of write_sid_reg.pio. Core 0 pushes, core 1 fetches the writes that are
+// due in the next cycles and clocks the SID exactly up to each of them.
+//
+// The 17 bit bus timestamps are mapped to the emulation cycle with a fixed
+// latency. The distance between two writes is kept exactly, only when the
+// emulation runs out of the window [0, 2 * latency] (drift between PHI2
+// and the audio clock or a long pause) the next write is resynced to
+// latency cycles ahead. Every write is mapped as soon as Fetch finds it in
+// the ring, so the window also limits the backlog when the emulation runs
+// slower than PHI2.
+//
+// Alternatively a DMA channel writes the FIFO words into the ring, then
+// the head is taken from the write address and the transfer count of the
+// channel. It does not wait for core 1, writes it has overwritten before
+// they were fetched are counted in overruns.
+//
+// head, tail and resolved count all writes, the ring index are the low bits.
+//
+// With two SIDs bit 5 of the write address selects the SID (A5).
+
+#define BUS_QUEUE_SIZE 256	// Power of two
+
+#ifndef SID_COUNT
+#define SID_COUNT 1
+#endif
+
+#if SID_COUNT > 1
+// write_sid_reg_a5: A5 (bit 18) is bit 5 of the address, 13 bit timestamp
+#define BUS_TIMESTAMP_SHIFT 19
+#define BUS_TIMESTAMP_MASK 0x1fff
+#define BUS_ADDRESS(word) ((((word) >> 2) & 0x1f) | (((word) >> 13) & 0x20))
+#else
+#define BUS_TIMESTAMP_SHIFT 15
+#define BUS_TIMESTAMP_MASK 0x1ffff
+#define BUS_ADDRESS(word) (((word) >> 2) & 0x1f)
+#endif
+
+class SID_BUS_QUEUE
+{
+public:
+	SID_BUS_QUEUE();
+
+	void Reset(cycle_count latency);
+
+	// Core 0
+	bool Push(uint32_t word);
+
+	// DMA mode, the WRITE_ADDR and TRANS_COUNT registers of the channel
+	void SetDmaRegisters(const volatile uint32_t* write_address, const volatile uint32_t* transfer_count);
+	// Ring index of the next write
+	uint32_t Head();
+
+	// Core 1, writes due in the next cycles, cycle of the writes is relative to now
+	int Fetch(SID_WRITE* writes, int max_count, cycle_count cycles);
+
+	uint32_t buffer[BUS_QUEUE_SIZE] __attribute__((aligned(BUS_QUEUE_SIZE * 4)));
+	uint32_t target[BUS_QUEUE_SIZE];	// Emulation cycle of each write, set by Resolve
+	volatile uint32_t head;		// Written by core 0
+	volatile uint32_t tail;		// Written by core 1
+
+	const volatile uint32_t* dma_write_address;
+	const volatile uint32_t* dma_transfer_count;
+
+	volatile uint32_t overruns;
+	volatile uint32_t resyncs;
+
+private:
+	uint32_t DmaHead();
+	uint32_t Resolve(uint32_t word);
+
+	uint32_t dma_head;
+	uint32_t dma_last_count;
+
+	cycle_count latency;
+	uint32_t emulation_cycle;
+
+	uint32_t resolved;		// Writes up to here have their target
+	uint32_t last_target;
+	uint32_t last_timestamp;
+};
+
+inline SID_BUS_QUEUE::SID_BUS_QUEUE()
+{
+	Reset(96);
+}
+
+inline void SID_BUS_QUEUE::Reset(cycle_count latency)
+{
+	this->latency = latency;
+
+	head = tail = 0;
+	dma_write_address = 0;
+	dma_transfer_count = 0;
+	dma_head = 0;
+	overruns = resyncs = 0;
+
+	emulation_cycle = 0;
+	resolved = 0;
+	last_target = 0;
+	last_timestamp = 0;
+}
+
+inline bool SID_BUS_QUEUE::Push(uint32_t word)
+{
+	uint32_t current_head = head;
+
+	if (current_head - tail == BUS_QUEUE_SIZE)
+	{
+		overruns++;
+		return false;
+	}
+
+	buffer[current_head & (BUS_QUEUE_SIZE - 1)] = word;
+	__sync_synchronize();	// Word before head
+	head = current_head + 1;
+	return true;
+}
+
+inline void SID_BUS_QUEUE::SetDmaRegisters(const volatile uint32_t* write_address, const volatile uint32_t* transfer_count)
+{
+	dma_write_address = write_address;
+	dma_transfer_count = transfer_count;
+	dma_last_count = *transfer_count;
+}
+
+inline uint32_t SID_BUS_QUEUE::Head()
+{
+	if (dma_write_address)
+		return ((*dma_write_address - (uint32_t)(uintptr_t)buffer) >> 2) & (BUS_QUEUE_SIZE - 1);
+
+	return head & (BUS_QUEUE_SIZE - 1);
+}
+
+// The write address gives the ring index, the transfer count (counts down)
+// the laps since the last call. It is read first and one off when the IRQ
+// restarts the channel, the laps are rounded.
+inline uint32_t SID_BUS_QUEUE::DmaHead()
+{
+	uint32_t count = *dma_transfer_count;
+	uint32_t step = (Head() - dma_head) & (BUS_QUEUE_SIZE - 1);
+	uint32_t written = dma_last_count - count;
+
+	dma_head += step + ((written - step + BUS_QUEUE_SIZE / 2) & ~(BUS_QUEUE_SIZE - 1));
+	dma_last_count = count;
+	return dma_head;
+}
+
+inline uint32_t SID_BUS_QUEUE::Resolve(uint32_t word)
+{
+	// Y of the PIO counts down
+	uint32_t timestamp = ~(word >> BUS_TIMESTAMP_SHIFT) & BUS_TIMESTAMP_MASK;
+	uint32_t target = last_target + ((timestamp - last_timestamp) & BUS_TIMESTAMP_MASK);
+
+	int32_t distance = (int32_t)(target - emulation_cycle);
+	if (distance < 0 || distance > 2 * latency)
+	{
+		target = emulation_cycle + latency;
+		resyncs++;
+	}
+
+	last_target = target;
+	last_timestamp = timestamp;
+
+	return target;
+}
+
+inline int SID_BUS_QUEUE::Fetch(SID_WRITE* writes, int max_count, cycle_count cycles)
+{
+	int count = 0;
+	uint32_t current_head = dma_write_address ? DmaHead() : head;
+
+	// DMA mode: the channel has overwritten writes that were not fetched,
+	// go on with the newer half of the ring
+	if (current_head - tail > BUS_QUEUE_SIZE)
+	{
+		uint32_t lost = current_head - BUS_QUEUE_SIZE / 2 - tail;
+		overruns += lost;
+		tail += lost;
+		if ((int32_t)(resolved - tail) < 0)
+			resolved = tail;
+	}
+
+	__sync_synchronize();	// Head before words
+	while (resolved != current_head)
+	{
+		const uint32_t index = resolved & (BUS_QUEUE_SIZE - 1);
+		target[index] = Resolve(buffer[index]);
+		resolved++;
+	}
+
+	while (count < max_count && tail != resolved)
+	{
+		const uint32_t index = tail & (BUS_QUEUE_SIZE - 1);
+		int32_t distance = (int32_t)(target[index] - emulation_cycle);
+		if (distance >= cycles)
+			break;
+
+		uint32_t word = buffer[index];
+		writes[count].cycle = distance < 0 ? 0 : distance;
+		writes[count].address = BUS_ADDRESS(word);
+		writes[count].value = (word >> 7) & 0xff;
+		count++;
+
+		tail++;
+	}
+
+	emulation_cycle += cycles;
+	return count;
+}
+
+#endif // SID_BUS_QUEUE_CLASS_H
@@ -15,6 +15,74 @@
 #ifndef SID_DAC_H
 #define SID_DAC_H
 
-void BuildDacTable(unsigned short* dac, int bits, double _2R_div_R, bool term);
+// Output of a BITS wide R-2R ladder DAC per input value, built at compile time
+template<int BITS>
+struct SID_DAC_TABLE
+{
+    unsigned short value[1 << BITS];
+
+    constexpr unsigned short operator[](int i) const
+    {
+        return value[i];
+    }
+};
+
+template<int BITS>
+constexpr SID_DAC_TABLE<BITS> BuildDacTable(double _2R_div_R, bool term)
+{
+    SID_DAC_TABLE<BITS> dac = {};
+    double vbit[BITS] = {};
+
+    // Rn is infinite for the missing termination
+    for (int set_bit = 0; set_bit < BITS; set_bit++) {
+        int bit = 0;
+
+        double Vn = 1.0;          // Normalized bit voltage.
+        double R = 1.0;           // Normalized R
+        double _2R = _2R_div_R*R; // 2R
+        bool Rn_infinite = !term; // Rn = 2R for correct termination,
+        double Rn = _2R;          // INFINITY for missing termination.
+
+        for (bit = 0; bit < set_bit; bit++) {
+            if (Rn_infinite) {
+                Rn = R + _2R;
+                Rn_infinite = false;
+            }
+            else {
+                Rn = R + _2R*Rn/(_2R + Rn); // R + 2R || Rn
+            }
+        }
+
+        if (Rn_infinite) {
+            Rn = _2R;
+        }
+        else {
+            Rn = _2R*Rn/(_2R + Rn);  // 2R || Rn
+            Vn = Vn*Rn/_2R;
+        }
+
+        for (++bit; bit < BITS; bit++) {
+            Rn += R;
+            double I = Vn/Rn;
+            Rn = _2R*Rn/(_2R + Rn);  // 2R || Rn
+            Vn = Rn*I;
+        }
+
+        vbit[set_bit] = Vn;
+    }
+
+    for (int i = 0; i < (1 << BITS); i++) {
+        int x = i;
+        double Vo = 0;
+        for (int j = 0; j < BITS; j++) {
+            Vo += (x & 0x1)*vbit[j];
+            x >>= 1;
+        }
+
+        dac.value[i] = (unsigned short)(((1 << BITS) - 1)*Vo + 0.5);
+    }
+
+    return dac;
+}
 
 #endif // SID_DAC_H
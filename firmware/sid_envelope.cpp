@@ -13,7 +13,6 @@
 //////////////////////////////////////////////////
 
 #include "./sid_envelope.h"
-#include "./sid_dac.h"
 
 reg16 SID_ENVELOPE::rate_counter_period[] = {
     8,  //   2ms*1.0MHz/256 =     7.81
@@ -53,28 +52,19 @@ reg8 SID_ENVELOPE::sustain_level[] = {
     0xff,
 };
 
-// DAC lookup tables.
-unsigned short SID_ENVELOPE::model_dac[2][1 << 8] = {
-    {0},
-    {0},
-    };
+// DAC lookup tables for 8-bit DACs, built at compile time.
+// MOS 6581: 2R/R ~ 2.20, missing termination resistor.
+// MOS 8580: 2R/R ~ 2.00, correct termination.
+static constexpr SID_DAC_TABLE<8> model_dac_6581 = BuildDacTable<8>(2.20, false);
+static constexpr SID_DAC_TABLE<8> model_dac_8580 = BuildDacTable<8>(2.00, true);
 
+SID_TIME_CRITICAL_TABLE const SID_DAC_TABLE<8> SID_ENVELOPE::model_dac[2] = {
+    model_dac_6581,
+    model_dac_8580,
+};
 
 SID_ENVELOPE::SID_ENVELOPE()
 {
-    static bool class_init;
-
-    if (!class_init)
-    {
-        // Build DAC lookup tables for 8-bit DACs.
-        // MOS 6581: 2R/R ~ 2.20, missing termination resistor.
-        BuildDacTable(model_dac[0], 8, 2.20, false);
-        // MOS 8580: 2R/R ~ 2.00, correct termination.
-        BuildDacTable(model_dac[1], 8, 2.00, true);
-
-        class_init = true;
-    }
-
     SetSidType(MOS_6581);
 
     // Counter's odd bits are high on powerup
@@ -98,6 +88,9 @@ void SID_ENVELOPE::SetSidType(sid_type type)
 
 void SID_ENVELOPE::Reset()
 {
+    pending_cycles = 0;
+    env3 = envelope_counter;
+
     envelope_pipeline = 0;
     exponential_pipeline = 0;
 
@@ -119,14 +112,19 @@ void SID_ENVELOPE::Reset()
     state = RELEASE;
     rate_period = rate_counter_period[release];
     hold_zero = false;
+
+    event_cycles = NextEvent();
 }
 
-void SID_ENVELOPE::WriteControlReg(reg8 value)
+SID_TIME_CRITICAL void SID_ENVELOPE::WriteControlReg(reg8 value)
 {
     reg8 gate_next = value & 0x01;
 
     if (gate != gate_next)
     {
+        // The next Clock() takes the new state (state_pipeline)
+        Sync();
+
         next_state = gate_next ? ATTACK : RELEASE;
         if (next_state == ATTACK)
         {
@@ -144,8 +142,10 @@ void SID_ENVELOPE::WriteControlReg(reg8 value)
     }
 }
 
-void SID_ENVELOPE::WriteAttackDecay(reg8 value)
+SID_TIME_CRITICAL void SID_ENVELOPE::WriteAttackDecay(reg8 value)
 {
+    Sync();
+
     attack = (value >> 4) & 0x0f;
     decay = value & 0x0f;
     if (state == ATTACK)
@@ -156,16 +156,22 @@ void SID_ENVELOPE::WriteAttackDecay(reg8 value)
     {
         rate_period = rate_counter_period[decay];
     }
+
+    event_cycles = NextEvent();
 }
 
-void SID_ENVELOPE::WriteSustainRelease(reg8 value)
+SID_TIME_CRITICAL void SID_ENVELOPE::WriteSustainRelease(reg8 value)
 {
+    Sync();
+
     sustain = (value >> 4) & 0x0f;
     release = value & 0x0f;
     if (state == RELEASE)
     {
         rate_period = rate_counter_period[release];
     }
+
+    event_cycles = NextEvent();
 }
 
 reg8 SID_ENVELOPE::OutWaveform()
@@ -18,6 +18,11 @@
 #include <stdint.h>
 
 #include "./pico_sid_defs.h"
+#include "./sid_dac.h"
+
+// Longest time between two updates of the envelope state (keeps the pending
+// cycles in range when the envelope is frozen)
+#define ENVELOPE_MAX_EVENT_CYCLES (1 << 20)
 
 class SID_ENVELOPE
 {
@@ -28,6 +33,9 @@ public:
     enum State { ATTACK, DECAY_SUSTAIN, RELEASE, FREEZED };
 
     void SetSidType(sid_type type);
+    // Single cycle with the pipeline delays, a SID is clocked either
+    // this way or by delta_t from Reset() on
+    void Clock();
     void Clock(cycle_count delta_t);
     void Reset();
 
@@ -39,10 +47,22 @@ public:
     void StateChange();
     void SetExponentialCounter();
 
+    // Brings the envelope state up to date, Clock() only counts the cycles
+    // until the next change of envelope_counter
+    void Sync();
+
     // 8-bit envelope output.
     short Output();
 
 protected:
+    void ClockSteps(cycle_count delta_t);
+    bool Frozen();
+    cycle_count NextEvent();
+
+    // Cycles clocked but not yet applied to the state below and the
+    // cycles from this state up to the next change of envelope_counter
+    cycle_count pending_cycles;
+    cycle_count event_cycles;
 
     reg16 rate_counter;
     reg16 rate_period;
@@ -73,17 +93,97 @@ protected:
     // Lookup tables
     static reg16 rate_counter_period[];
     static reg8 sustain_level[];
-    static unsigned short model_dac[2][1 << 8];
+    static const SID_DAC_TABLE<8> model_dac[2];
 
     friend class PICO_SID;
 };
 
-inline void SID_ENVELOPE::Clock(cycle_count delta_t)
+// ----------------------------------------------------------------------------
+// SID clocking - 1 cycle.
+// ----------------------------------------------------------------------------
+SID_TIME_CRITICAL_INLINE inline void SID_ENVELOPE::Clock()
+{
+    // The ENV3 value is sampled in the first phase of the clock
+    env3 = envelope_counter;
+
+    if (unlikely(state_pipeline)) {
+        StateChange();
+    }
+
+    // If the exponential counter period != 1, the envelope decrement is delayed
+    // 1 cycle. This is only modeled for single cycle clocking.
+    if (unlikely(envelope_pipeline != 0) && (--envelope_pipeline == 0)) {
+        if (likely(!hold_zero)) {
+            if (state == ATTACK) {
+                ++envelope_counter &= 0xff;
+                if (unlikely(envelope_counter == 0xff)) {
+                    state = DECAY_SUSTAIN;
+                    rate_period = rate_counter_period[decay];
+                }
+            }
+            else if ((state == DECAY_SUSTAIN) || (state == RELEASE)) {
+                --envelope_counter &= 0xff;
+            }
+
+            SetExponentialCounter();
+        }
+    }
+
+    if (unlikely(exponential_pipeline != 0) && (--exponential_pipeline == 0)) {
+        exponential_counter = 0;
+
+        if (((state == DECAY_SUSTAIN) && (envelope_counter != sustain_level[sustain]))
+            || (state == RELEASE)) {
+            // The envelope counter can flip from 0x00 to 0xff by changing state to
+            // attack, then to release. The envelope counter will then continue
+            // counting down in the release state.
+            // This has been verified by sampling ENV3.
+            envelope_pipeline = 1;
+        }
+    }
+    else if (unlikely(reset_rate_counter)) {
+        rate_counter = 0;
+        reset_rate_counter = false;
+
+        if (state == ATTACK) {
+            // The first envelope step in the attack state also resets the exponential
+            // counter. This has been verified by sampling ENV3.
+            exponential_counter = 0; // NOTE this is actually delayed one cycle, not modeled
+
+            // The envelope counter can flip from 0xff to 0x00 by changing state to
+            // release, then to attack. The envelope counter is then frozen at
+            // zero; to unlock this situation the state must be changed to release,
+            // then to attack. This has been verified by sampling ENV3.
+            envelope_pipeline = 2;
+        }
+        else {
+            if ((!hold_zero) && ++exponential_counter == exponential_counter_period) {
+                exponential_pipeline = exponential_counter_period != 1 ? 2 : 1;
+            }
+        }
+    }
+
+    // Check for ADSR delay bug (see ClockSteps()).
+    if (likely(rate_counter != rate_period)) {
+        if (unlikely(++rate_counter & 0x8000)) {
+            ++rate_counter &= 0x7fff;
+        }
+    }
+    else {
+        reset_rate_counter = true;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SID clocking - delta_t cycles.
+// ----------------------------------------------------------------------------
+SID_TIME_CRITICAL_INLINE inline void SID_ENVELOPE::Clock(cycle_count delta_t)
 {
     // NB! Any pipelined envelope counter decrement from single cycle clocking
     // will be lost. It is not worth the trouble to flush the pipeline here.
 
     if (unlikely(state_pipeline)) {
+        // The write setting state_pipeline has already synced the state.
         if (next_state == ATTACK) {
             state = ATTACK;
             hold_zero = false;
@@ -95,8 +195,60 @@ inline void SID_ENVELOPE::Clock(cycle_count delta_t)
             hold_zero = true;
         }
         state_pipeline = 0;
+        event_cycles = NextEvent();
     }
 
+    // Nothing to do until envelope_counter changes.
+    pending_cycles += delta_t;
+    if (likely(pending_cycles < event_cycles)) {
+        return;
+    }
+
+    Sync();
+
+    // envelope_counter only changes here
+    env3 = envelope_counter;
+}
+
+SID_TIME_CRITICAL_INLINE inline void SID_ENVELOPE::Sync()
+{
+    ClockSteps(pending_cycles);
+    pending_cycles = 0;
+    event_cycles = NextEvent();
+}
+
+// ----------------------------------------------------------------------------
+// envelope_counter can not change: Frozen at zero or sustain level reached.
+// ----------------------------------------------------------------------------
+SID_TIME_CRITICAL_INLINE inline bool SID_ENVELOPE::Frozen()
+{
+    return hold_zero || (state == DECAY_SUSTAIN && envelope_counter == sustain_level[sustain]);
+}
+
+// ----------------------------------------------------------------------------
+// Cycles up to the next rate counter step which changes envelope_counter.
+// ----------------------------------------------------------------------------
+SID_TIME_CRITICAL_INLINE inline cycle_count SID_ENVELOPE::NextEvent()
+{
+    if (Frozen()) {
+        return ENVELOPE_MAX_EVENT_CYCLES;
+    }
+
+    int rate_step = rate_period - rate_counter;
+    if (unlikely(rate_step <= 0)) {
+        rate_step += 0x7fff;
+    }
+
+    // In attack every step counts, else every exponential_counter_period step.
+    if (state != ATTACK) {
+        rate_step += (exponential_counter_period - 1 - exponential_counter)*rate_period;
+    }
+
+    return rate_step < ENVELOPE_MAX_EVENT_CYCLES ? rate_step : ENVELOPE_MAX_EVENT_CYCLES;
+}
+
+SID_TIME_CRITICAL_INLINE inline void SID_ENVELOPE::ClockSteps(cycle_count delta_t)
+{
     // Check for ADSR delay bug.
     // If the rate counter comparison value is set below the current value of the
     // rate counter, the counter will continue counting up until it wraps around
@@ -181,10 +333,32 @@ inline void SID_ENVELOPE::Clock(cycle_count delta_t)
         }
 
         rate_step = rate_period;
+
+        // Steps which only count the exponential counter are done at once.
+        if (unlikely(delta_t >= rate_step)) {
+            cycle_count steps = delta_t/rate_step;
+
+            if (Frozen()) {
+                // In attack the exponential counter stays 0.
+                if (state != ATTACK) {
+                    exponential_counter = (exponential_counter + steps) % exponential_counter_period;
+                }
+            } else if (state != ATTACK) {
+                cycle_count idle = exponential_counter_period - 1 - exponential_counter;
+                if (steps > idle) {
+                    steps = idle;
+                }
+                exponential_counter += steps;
+            } else {
+                steps = 0;
+            }
+
+            delta_t -= steps*rate_step;
+        }
     }
 }
 
-inline void SID_ENVELOPE::StateChange()
+SID_TIME_CRITICAL_INLINE inline void SID_ENVELOPE::StateChange()
 {
     state_pipeline--;
 
@@ -211,7 +385,7 @@ inline void SID_ENVELOPE::StateChange()
     }
 }
 
-inline void SID_ENVELOPE::SetExponentialCounter()
+SID_TIME_CRITICAL_INLINE inline void SID_ENVELOPE::SetExponentialCounter()
 {
     // Check for change of exponential counter period.
     switch (envelope_counter) {
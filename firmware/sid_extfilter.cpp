@@ -34,7 +34,16 @@ void SID_EXTFILTER::SetSidType(sid_type type)
 
 void SID_EXTFILTER::EnableFilter(bool enable)
 {
+	// This is handy for testing.
+	// Disabled remove maximum DC level since there is no filter to do it.
 	enabled = enable;
+	bypass_mask = enabled ? 0 : -1;
+
+	if (!enabled)
+	{
+		Vlp = 0;
+		Vhp = 0;
+	}
 }
 
 void SID_EXTFILTER::Reset()
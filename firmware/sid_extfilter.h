@@ -29,11 +29,15 @@ public:
     void Reset();
 
 	void Clock(cycle_count delta_t, int Vi);
+	template<cycle_count DELTA_T>
+	void Clock(int Vi);
 	int Output();
 
 protected:
+	void Step(cycle_count delta_t_flt, int Vi, int w0lp, int w0hp);
 
 	bool enabled;
+	int bypass_mask;	// -1 = filter disabled
 	
 	// Maximum mixer DC offset.
 	
@@ -52,16 +56,28 @@ protected:
 // ----------------------------------------------------------------------------
 // SID clocking - delta_t cycles.
 // ----------------------------------------------------------------------------
-inline void SID_EXTFILTER::Clock(cycle_count delta_t, int Vi)
+SID_TIME_CRITICAL_INLINE inline void SID_EXTFILTER::Step(cycle_count delta_t_flt, int Vi, int w0lp, int w0hp)
 {
-	// This is handy for testing.
-	if (!enabled)
-	{
-    	// Remove maximum DC level since there is no filter to do it.
-    	Vlp = Vhp = 0;
-    	Vo = Vi - mixer_dc;
-    	return;
-	}
+	// delta_t is converted to seconds given a 1MHz clock by dividing
+	// with 1 000 000.
+
+	// Calculate filter outputs.
+	// Vo  = Vlp - Vhp;
+	// Vlp = Vlp + w0lp*(Vi - Vlp)*delta_t;
+	// Vhp = Vhp + w0hp*(Vlp - Vhp)*delta_t;
+
+	int dVlp = (w0lp*delta_t_flt >> 8)*(Vi - Vlp) >> 12;
+	int dVhp = w0hp*delta_t_flt*(Vlp - Vhp) >> 20;
+	Vo = Vlp - Vhp + ((Vi - mixer_dc) & bypass_mask);
+	Vlp += dVlp;
+	Vhp += dVhp;
+}
+
+SID_TIME_CRITICAL_INLINE inline void SID_EXTFILTER::Clock(cycle_count delta_t, int Vi)
+{
+	// Disabled the integrators stay 0 and Vi is passed through (see EnableFilter)
+	const int w0lp = this->w0lp & ~bypass_mask;
+	const int w0hp = this->w0hp & ~bypass_mask;
 
 	// Maximum delta cycles for the external filter to work satisfactorily
   	// is approximately 8.
@@ -74,24 +90,26 @@ inline void SID_EXTFILTER::Clock(cycle_count delta_t, int Vi)
       		delta_t_flt = delta_t;
     	}
 
-    	// delta_t is converted to seconds given a 1MHz clock by dividing
-    	// with 1 000 000.
-
-    	// Calculate filter outputs.
-    	// Vo  = Vlp - Vhp;
-    	// Vlp = Vlp + w0lp*(Vi - Vlp)*delta_t;
-    	// Vhp = Vhp + w0hp*(Vlp - Vhp)*delta_t;
-
-    	int dVlp = (w0lp*delta_t_flt >> 8)*(Vi - Vlp) >> 12;
-    	int dVhp = w0hp*delta_t_flt*(Vlp - Vhp) >> 20;
-    	Vo = Vlp - Vhp;
-    	Vlp += dVlp;
-    	Vhp += dVhp;
+		Step(delta_t_flt, Vi, w0lp, w0hp);
 
     	delta_t -= delta_t_flt;
   	}
 }
 
+// Same steps as Clock(delta_t, Vi) for a fixed delta_t, the loop is unrolled
+template<cycle_count DELTA_T>
+SID_TIME_CRITICAL_INLINE inline void SID_EXTFILTER::Clock(int Vi)
+{
+	const int w0lp = this->w0lp & ~bypass_mask;
+	const int w0hp = this->w0hp & ~bypass_mask;
+
+	for (int i = 0; i < DELTA_T / 8; i++)
+		Step(8, Vi, w0lp, w0hp);
+
+	if (DELTA_T % 8)
+		Step(DELTA_T % 8, Vi, w0lp, w0hp);
+}
+
 // ----------------------------------------------------------------------------
 // Audio output (19.5 bits).
 // ----------------------------------------------------------------------------
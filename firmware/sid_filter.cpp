@@ -14,7 +14,7 @@
 
 #include "./sid_filter.h"
 
-fc_point SID_FILTER::f0_points_6581[] =
+static constexpr fc_point f0_points_6581[] =
 {
   //  FC      f         FCHI FCLO
   // ----------------------------
@@ -51,7 +51,7 @@ fc_point SID_FILTER::f0_points_6581[] =
   { 2047, 18000 }    // 0xff 0x07 - repeated end point
 };
 
-fc_point SID_FILTER::f0_points_8580[] =
+static constexpr fc_point f0_points_8580[] =
 {
   //  FC      f         FCHI FCLO
   // ----------------------------
@@ -76,6 +76,86 @@ fc_point SID_FILTER::f0_points_8580[] =
   { 2047, 12500 }    // 0xff 0x07 - repeated end point
 };
 
+// Mapping from FC to cutoff frequency, interpolated at compile time.
+// The end points are repeated since they are not interpolated.
+template<int N>
+static constexpr SID_F0_TABLE BuildF0Table(const fc_point (&points)[N])
+{
+	SID_F0_TABLE table = {};
+
+	interpolate(points, points + N - 1, PointPlotter<short>(table.value), 1.0);
+
+	return table;
+}
+
+// Multiply with 1.048576 to facilitate division by 1 000 000 by right-
+// shifting 20 times (2 ^ 20 = 1048576).
+static constexpr double pi = 3.1415926535897932385;
+
+static constexpr int W0(double f)
+{
+	return static_cast<int>(2*pi*f*1.048576);
+}
+
+// Limit f0 to 16kHz to keep 1 cycle filter stable.
+static constexpr int w0_max_1 = W0(16000);
+// Limit f0 to 4kHz to keep delta_t cycle filter stable.
+static constexpr int w0_max_dt = W0(4000);
+
+// The register writes only load from the tables, no soft float in the bus IRQ
+template<typename TABLE>
+static constexpr TABLE BuildW0Table(const SID_F0_TABLE& f0, int w0_max)
+{
+	TABLE table = {};
+
+	for (int fc = 0; fc < 2048; fc++)
+	{
+		const int w0 = W0(f0.value[fc]);
+		table.value[fc] = w0 <= w0_max ? w0 : w0_max;
+	}
+
+	return table;
+}
+
+static constexpr SID_F0_TABLE f0_6581 = BuildF0Table(f0_points_6581);
+static constexpr SID_F0_TABLE f0_8580 = BuildF0Table(f0_points_8580);
+
+static constexpr SID_W0_TABLE w0_6581_init = BuildW0Table<SID_W0_TABLE>(f0_6581, w0_max_dt);
+static constexpr SID_W0_TABLE w0_8580_init = BuildW0Table<SID_W0_TABLE>(f0_8580, w0_max_dt);
+
+// SetW0 runs in the bus write path, with SID_HOT_PATH_IN_RAM the tables
+// are in SRAM (8 KB) so an FC write never waits for the XIP cache
+SID_TIME_CRITICAL_TABLE static const SID_W0_TABLE w0_6581 = w0_6581_init;
+SID_TIME_CRITICAL_TABLE static const SID_W0_TABLE w0_8580 = w0_8580_init;
+
+// Only read by the cycle exact filter, every cycle from the same
+// entry, which stays in the XIP cache (2 x 8 KB flash)
+static constexpr SID_W0_1_TABLE w0_1_6581 = BuildW0Table<SID_W0_1_TABLE>(f0_6581, w0_max_1);
+static constexpr SID_W0_1_TABLE w0_1_8580 = BuildW0Table<SID_W0_1_TABLE>(f0_8580, w0_max_1);
+
+// Q is controlled linearly by res. Q has approximate range [0.707, 1.7].
+// As resonance is increased, the filter must be clocked more often to keep
+// stable.
+// The coefficient 1024 is dispensed of later by right-shifting 10 times
+// (2 ^ 10 = 1024).
+struct SID_Q_TABLE
+{
+	int value[16];
+};
+
+static constexpr SID_Q_TABLE BuildQTable()
+{
+	SID_Q_TABLE table = {};
+
+	for (int res = 0; res < 16; res++)
+		table.value[res] = static_cast<int>(1024.0/(0.707 + 1.0*res/0x0f));
+
+	return table;
+}
+
+static constexpr SID_Q_TABLE _1024_div_Q_init = BuildQTable();
+SID_TIME_CRITICAL_TABLE static const SID_Q_TABLE _1024_div_Q_table = _1024_div_Q_init;
+
 SID_FILTER::SID_FILTER()
 {
 	fc = 0;
@@ -93,10 +173,6 @@ SID_FILTER::SID_FILTER()
 
   	EnableFilter(true);
 
-  	// Create mappings from FC to cutoff frequency.
-  	interpolate(f0_points_6581, f0_points_6581 + sizeof(f0_points_6581)/sizeof(*f0_points_6581) - 1, PointPlotter<int>(f0_6581), 1.0);
-  	interpolate(f0_points_8580, f0_points_8580 + sizeof(f0_points_8580)/sizeof(*f0_points_8580) - 1, PointPlotter<int>(f0_8580), 1.0);
-
 	SetSidType(MOS_6581);
 
 	Reset();
@@ -109,11 +185,37 @@ SID_FILTER::~SID_FILTER()
 
 void SID_FILTER::EnableFilter(bool enable)
 {
+	// Enable filter on/off.
+	// This is not really part of SID, but is useful for testing.
+	// Disabled nothing is routed through the filter, the state stays 0.
 	enabled = enable;
+
+	if (!enabled) {
+		Vhp = Vbp = Vlp = 0;
+	}
+
+	SetRouting();
+}
+
+SID_TIME_CRITICAL void SID_FILTER::SetRouting()
+{
+	const int on = enabled ? -1 : 0;
+
+	for (int i = 0; i < 4; i++)
+		filt_mask[i] = -static_cast<int>((filt >> i) & 1) & on;
+
+	// NB! Voice 3 is not silenced by voice3off if it is routed through
+	// the filter.
+	voice3_mask = (voice3off && !(filt & 0x04)) ? 0 : -1;
+
+	for (int i = 0; i < 3; i++)
+		mode_mask[i] = -static_cast<int>((hp_bp_lp >> (2 - i)) & 1) & on;
 }
 
 void SID_FILTER::SetSidType(sid_type type)
 {
+	sid_model = type;
+
  	if (type == MOS_6581) 
  	{
 		// The mixer has a small input DC offset. This is found as follows:
@@ -128,18 +230,16 @@ void SID_FILTER::SetSidType(sid_type type)
 
     	mixer_DC = -0xfff*0xff/18 >> 7;
 
-    	f0 = f0_6581;
-    	f0_points = f0_points_6581;
-    	f0_count = sizeof(f0_points_6581)/sizeof(*f0_points_6581);
+    	w0_table = w0_6581.value;
+    	w0_1_table = w0_1_6581.value;
   	}
   	else 
 	{
 		// No DC offsets in the MOS8580.
 		mixer_DC = 0;
 
-		f0 = f0_8580;
-		f0_points = f0_points_8580;
-		f0_count = sizeof(f0_points_8580)/sizeof(*f0_points_8580);
+		w0_table = w0_8580.value;
+		w0_1_table = w0_1_8580.value;
   	}
 
 	SetW0();
@@ -166,64 +266,50 @@ void SID_FILTER::Reset()
 	Vlp = 0;
 	Vnf = 0;
 
+	SetRouting();
 	SetW0();
 	SetQ();
 }
 
-void SID_FILTER::WriteFcLo(reg8 value)
+SID_TIME_CRITICAL void SID_FILTER::WriteFcLo(reg8 value)
 {
 	fc = (fc & 0x7f8) | (value & 0x007);
 	SetW0();
 }
 
-void SID_FILTER::WriteFcHi(reg8 value)
+SID_TIME_CRITICAL void SID_FILTER::WriteFcHi(reg8 value)
 {
 	fc = ((value << 3) & 0x7f8) | (fc & 0x007);
 	SetW0();
 }
 
-void SID_FILTER::WriteResFilt(reg8 value)
+SID_TIME_CRITICAL void SID_FILTER::WriteResFilt(reg8 value)
 {
 	res = (value >> 4) & 0x0f;
 	SetQ();
 	filt = value & 0x0f;
+	SetRouting();
 }
 
-void SID_FILTER::WriteModeVol(reg8 value)
+SID_TIME_CRITICAL void SID_FILTER::WriteModeVol(reg8 value)
 {
 	voice3off = value & 0x80;
 	hp_bp_lp = (value >> 4) & 0x07;
 	vol = value & 0x0f;
+	SetRouting();
 }
 
 // Set filter cutoff frequency.
-void SID_FILTER::SetW0()
+SID_TIME_CRITICAL void SID_FILTER::SetW0()
 {
-  const double pi = 3.1415926535897932385;
-
-  // Multiply with 1.048576 to facilitate division by 1 000 000 by right-
-  // shifting 20 times (2 ^ 20 = 1048576).
-  w0 = static_cast<int>(2*pi*f0[fc]*1.048576);
-
-  // Limit f0 to 16kHz to keep 1 cycle filter stable.
-  const int w0_max_1 = static_cast<int>(2*pi*16000*1.048576);
-  w0_ceil_1 = w0 <= w0_max_1 ? w0 : w0_max_1;
-
-  // Limit f0 to 4kHz to keep delta_t cycle filter stable.
-  const int w0_max_dt = static_cast<int>(2*pi*4000*1.048576);
-  w0_ceil_dt = w0 <= w0_max_dt ? w0 : w0_max_dt;
+  w0_ceil_dt = w0_table[fc];
+  w0_ceil_1 = w0_1_table + fc;
 }
 
 // Set filter resonance.
-void SID_FILTER::SetQ()
+SID_TIME_CRITICAL void SID_FILTER::SetQ()
 {
-  // Q is controlled linearly by res. Q has approximate range [0.707, 1.7].
-  // As resonance is increased, the filter must be clocked more often to keep
-  // stable.
-
-  // The coefficient 1024 is dispensed of later by right-shifting 10 times
-  // (2 ^ 10 = 1024).
-  _1024_div_Q = static_cast<int>(1024.0/(0.707 + 1.0*res/0x0f));
+  _1024_div_Q = _1024_div_Q_table.value[res];
 }
 
 // ----------------------------------------------------------------------------
@@ -236,19 +322,14 @@ void SID_FILTER::SetQ()
 // ----------------------------------------------------------------------------
 void SID_FILTER::FcDefault(const fc_point*& points, int& count)
 {
-  points = f0_points;
-  count = f0_count;
+  if (sid_model == MOS_6581)
+  {
+    points = f0_points_6581;
+    count = sizeof(f0_points_6581)/sizeof(*f0_points_6581);
+  }
+  else
+  {
+    points = f0_points_8580;
+    count = sizeof(f0_points_8580)/sizeof(*f0_points_8580);
+  }
 }
-
-// ----------------------------------------------------------------------------
-// Given an array of interpolation points p with n points, the following
-// statement will specify a new FC mapping:
-//   interpolate(p, p + n - 1, filter.fc_plotter(), 1.0);
-// Note that the x range of the interpolation points *must* be [0, 2047],
-// and that additional end points *must* be present since the end points
-// are not interpolated.
-// ----------------------------------------------------------------------------
-PointPlotter<int> SID_FILTER::FcPlotter()
-{
-  return PointPlotter<int>(f0);
-}
\ No newline at end of file
@@ -20,6 +20,25 @@
 #include "./pico_sid_defs.h"
 #include "./spline.h"
 
+// Cutoff frequency in Hz per FC value
+struct SID_F0_TABLE
+{
+	short value[2048];
+};
+
+// w0 = 2*pi*f0*1.048576 per FC value limited to 4kHz (w0_ceil_dt),
+// shared by all instances
+struct SID_W0_TABLE
+{
+	short value[2048];
+};
+
+// Same limited to 16kHz for the 1 cycle filter (w0_ceil_1), more than 16 bits
+struct SID_W0_1_TABLE
+{
+	int value[2048];
+};
+
 class SID_FILTER
 {
 public:
@@ -39,19 +58,22 @@ public:
 	void SetW0();
 	void SetQ();
 	void FcDefault(const fc_point*& points, int& count);
-	PointPlotter<int> FcPlotter();
 
     void Clock(cycle_count delta_t, int voice1, int voice2, int voice3, int ext_in);
+	template<cycle_count DELTA_T>
+	void Clock(int voice1, int voice2, int voice3, int ext_in);
+	// One cycle as reSID clock() with w0 limited to 16kHz, for cycle exact clocking
+	void ClockCycle(int voice1, int voice2, int voice3, int ext_in);
     int Output();
 
-	// Spline functions.
-  	void fc_default(const fc_point*& points, int& count);
-  	PointPlotter<int> fc_plotter();
-
 protected:
 	void set_w0();
 	void set_Q();
 
+	void SetRouting();
+	int Route(int voice1, int voice2, int voice3, int ext_in);
+	void Step(int w0_delta_t, int Vi);
+
 	// Filter enabled.
 	bool enabled;
 
@@ -70,6 +92,12 @@ protected:
 	// Highpass, bandpass, and lowpass filter modes.
 	reg8 hp_bp_lp;
 
+	// 0 / -1 masks of filt (voice 1, 2, 3, ext_in), voice3off and hp_bp_lp
+	// (hp, bp, lp), the filter is routed without branches
+	int filt_mask[4];
+	int voice3_mask;
+	int mode_mask[3];
+
 	// Output master volume.
 	reg4 vol;
 
@@ -83,154 +111,102 @@ protected:
 	int Vnf; // not filtered
 
 	// Cutoff frequency, resonance.
-	int w0, w0_ceil_1, w0_ceil_dt;
+	int w0_ceil_dt;
+	const int* w0_ceil_1;	// Into w0_1_table, only ClockCycle reads it
 	int _1024_div_Q;
 
-	// Cutoff frequency tables.
-	// FC is an 11 bit register.
-	int f0_6581[2048];
-	int f0_8580[2048];
-	int* f0;
-	static fc_point f0_points_6581[];
-	static fc_point f0_points_8580[];
-	fc_point* f0_points;
-	int f0_count;		
+	// w0 tables of the model (FC is an 11 bit register).
+	const short* w0_table;
+	const int* w0_1_table;
+	sid_type sid_model;
 
 	friend class PICO_SID;		
 };
 
-inline void SID_FILTER::Clock(cycle_count delta_t, int voice1, int voice2, int voice3, int ext_in)
+// ----------------------------------------------------------------------------
+// Route the voices into or around the filter, returns the filter input Vi.
+// ----------------------------------------------------------------------------
+SID_TIME_CRITICAL_INLINE inline int SID_FILTER::Route(int voice1, int voice2, int voice3, int ext_in)
 {
 	// Scale each voice down from 20 to 13 bits.
 	voice1 >>= 7;
 	voice2 >>= 7;
-
-	// NB! Voice 3 is not silenced by voice3off if it is routed through
-	// the filter.
-	if (voice3off && !(filt & 0x04)) {
-	voice3 = 0;
-	}
-	else {
-	voice3 >>= 7;
-	}
-
+	voice3 = (voice3 >> 7) & voice3_mask;
 	ext_in >>= 7;
 
-	// Enable filter on/off.
-	// This is not really part of SID, but is useful for testing.
-	// On slow CPUs it may be necessary to bypass the filter to lower the CPU
-	// load.
-	if (!enabled) {
-	Vnf = voice1 + voice2 + voice3 + ext_in;
-	Vhp = Vbp = Vlp = 0;
-	return;
-	}
-
-	// Route voices into or around filter.
-	// The code below is expanded to a switch for faster execution.
 	// (filt1 ? Vi : Vnf) += voice1;
 	// (filt2 ? Vi : Vnf) += voice2;
 	// (filt3 ? Vi : Vnf) += voice3;
+	// The masks are set at register write time by SetRouting().
+	int Vi = (voice1 & filt_mask[0]) + (voice2 & filt_mask[1]) + (voice3 & filt_mask[2]) + (ext_in & filt_mask[3]);
+	Vnf = voice1 + voice2 + voice3 + ext_in - Vi;
+
+	return Vi;
+}
 
-	int Vi;
-
-	switch (filt) {
-	default:
-	case 0x0:
-	Vi = 0;
-	Vnf = voice1 + voice2 + voice3 + ext_in;
-	break;
-	case 0x1:
-	Vi = voice1;
-	Vnf = voice2 + voice3 + ext_in;
-	break;
-	case 0x2:
-	Vi = voice2;
-	Vnf = voice1 + voice3 + ext_in;
-	break;
-	case 0x3:
-	Vi = voice1 + voice2;
-	Vnf = voice3 + ext_in;
-	break;
-	case 0x4:
-	Vi = voice3;
-	Vnf = voice1 + voice2 + ext_in;
-	break;
-	case 0x5:
-	Vi = voice1 + voice3;
-	Vnf = voice2 + ext_in;
-	break;
-	case 0x6:
-	Vi = voice2 + voice3;
-	Vnf = voice1 + ext_in;
-	break;
-	case 0x7:
-	Vi = voice1 + voice2 + voice3;
-	Vnf = ext_in;
-	break;
-	case 0x8:
-	Vi = ext_in;
-	Vnf = voice1 + voice2 + voice3;
-	break;
-	case 0x9:
-	Vi = voice1 + ext_in;
-	Vnf = voice2 + voice3;
-	break;
-	case 0xa:
-	Vi = voice2 + ext_in;
-	Vnf = voice1 + voice3;
-	break;
-	case 0xb:
-	Vi = voice1 + voice2 + ext_in;
-	Vnf = voice3;
-	break;
-	case 0xc:
-	Vi = voice3 + ext_in;
-	Vnf = voice1 + voice2;
-	break;
-	case 0xd:
-	Vi = voice1 + voice3 + ext_in;
-	Vnf = voice2;
-	break;
-	case 0xe:
-	Vi = voice2 + voice3 + ext_in;
-	Vnf = voice1;
-	break;
-	case 0xf:
-	Vi = voice1 + voice2 + voice3 + ext_in;
-	Vnf = 0;
-	break;
-  }
-
-  // Maximum delta cycles for the filter to work satisfactorily under current
-  // cutoff frequency and resonance constraints is approximately 8.
-  cycle_count delta_t_flt = 8;
-
-  while (delta_t) {
-    if (delta_t < delta_t_flt) {
-      delta_t_flt = delta_t;
-    }
-
-    // delta_t is converted to seconds given a 1MHz clock by dividing
-    // with 1 000 000. This is done in two operations to avoid integer
-    // multiplication overflow.
-
-    // Calculate filter outputs.
-    // Vhp = Vbp/Q - Vlp - Vi;
-    // dVbp = -w0*Vhp*dt;
-    // dVlp = -w0*Vbp*dt;
-    int w0_delta_t = w0_ceil_dt*delta_t_flt >> 6;
-
-    int dVbp = (w0_delta_t*Vhp >> 14);
-    int dVlp = (w0_delta_t*Vbp >> 14);
-    Vbp -= dVbp;
-    Vlp -= dVlp;
-    Vhp = (Vbp*_1024_div_Q >> 10) - Vlp - Vi;
-
-    delta_t -= delta_t_flt;
-  }
+// ----------------------------------------------------------------------------
+// One integration step of the filter.
+// ----------------------------------------------------------------------------
+SID_TIME_CRITICAL_INLINE inline void SID_FILTER::Step(int w0_delta_t, int Vi)
+{
+	// Calculate filter outputs.
+	// Vhp = Vbp/Q - Vlp - Vi;
+	// dVbp = -w0*Vhp*dt;
+	// dVlp = -w0*Vbp*dt;
+	int dVbp = (w0_delta_t*Vhp >> 14);
+	int dVlp = (w0_delta_t*Vbp >> 14);
+	Vbp -= dVbp;
+	Vlp -= dVlp;
+	Vhp = (Vbp*_1024_div_Q >> 10) - Vlp - Vi;
+}
+
+SID_TIME_CRITICAL_INLINE inline void SID_FILTER::Clock(cycle_count delta_t, int voice1, int voice2, int voice3, int ext_in)
+{
+	int Vi = Route(voice1, voice2, voice3, ext_in);
+
+	// Maximum delta cycles for the filter to work satisfactorily under current
+	// cutoff frequency and resonance constraints is approximately 8.
+	cycle_count delta_t_flt = 8;
+
+	while (delta_t) {
+		if (delta_t < delta_t_flt) {
+			delta_t_flt = delta_t;
+		}
+
+		// delta_t is converted to seconds given a 1MHz clock by dividing
+		// with 1 000 000. This is done in two operations to avoid integer
+		// multiplication overflow.
+		Step(w0_ceil_dt*delta_t_flt >> 6, Vi);
+
+		delta_t -= delta_t_flt;
+	}
 }
 
+// Same steps as Clock(delta_t, ...) for a fixed delta_t, the loop is unrolled
+template<cycle_count DELTA_T>
+SID_TIME_CRITICAL_INLINE inline void SID_FILTER::Clock(int voice1, int voice2, int voice3, int ext_in)
+{
+	int Vi = Route(voice1, voice2, voice3, ext_in);
+
+	for (int i = 0; i < DELTA_T / 8; i++)
+		Step(w0_ceil_dt*8 >> 6, Vi);
+
+	if (DELTA_T % 8)
+		Step(w0_ceil_dt*(DELTA_T % 8) >> 6, Vi);
+}
+
+SID_TIME_CRITICAL_INLINE inline void SID_FILTER::ClockCycle(int voice1, int voice2, int voice3, int ext_in)
+{
+	int Vi = Route(voice1, voice2, voice3, ext_in);
+
+	// delta_t = 1 is converted to seconds given a 1MHz clock by dividing
+	// with 1 000 000.
+	int dVbp = (*w0_ceil_1*Vhp >> 20);
+	int dVlp = (*w0_ceil_1*Vbp >> 20);
+	Vbp -= dVbp;
+	Vlp -= dVlp;
+	Vhp = (Vbp*_1024_div_Q >> 10) - Vlp - Vi;
+}
 
 // ----------------------------------------------------------------------------
 // SID audio output (20 bits).
@@ -238,49 +214,15 @@ inline void SID_FILTER::Clock(cycle_count delta_t, int voice1, int voice2, int v
 
 inline int SID_FILTER::Output()
 {
-	// This is handy for testing.
-	if (!enabled) {
-	return (Vnf + mixer_DC)*static_cast<int>(vol);
-	}
-
 	// Mix highpass, bandpass, and lowpass outputs. The sum is not
 	// weighted, this can be confirmed by sampling sound output for
 	// e.g. bandpass, lowpass, and bandpass+lowpass from a SID chip.
 
-	// The code below is expanded to a switch for faster execution.
 	// if (hp) Vf += Vhp;
 	// if (bp) Vf += Vbp;
 	// if (lp) Vf += Vlp;
-
-	int Vf;
-
-	switch (hp_bp_lp) {
-	default:
-	case 0x0:
-	Vf = 0;
-	break;
-	case 0x1:
-	Vf = Vlp;
-	break;
-	case 0x2:
-	Vf = Vbp;
-	break;
-	case 0x3:
-	Vf = Vlp + Vbp;
-	break;
-	case 0x4:
-	Vf = Vhp;
-	break;
-	case 0x5:
-	Vf = Vlp + Vhp;
-	break;
-	case 0x6:
-	Vf = Vbp + Vhp;
-	break;
-	case 0x7:
-	Vf = Vlp + Vbp + Vhp;
-	break;
-	}
+	// With the filter disabled all masks are 0.
+	int Vf = (Vhp & mode_mask[0]) + (Vbp & mode_mask[1]) + (Vlp & mode_mask[2]);
 
 	// Sum non-filtered and filtered output.
 	// Multiply the sum with volume.
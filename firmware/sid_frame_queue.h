@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: sid_frame_queue.h                     //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+#ifndef SID_FRAME_QUEUE_CLASS_H
+#define SID_FRAME_QUEUE_CLASS_H
+
+#include <stdint.h>
+
+#include "./pico_sid.h"
+
+// Lock free single producer / single consumer ring of SID_FRAMEs for SPLIT_CORES.
+// Core 0 clocks the voices of the next sample into a free slot, core 1 takes
+// one slot per sample for the filters. A slot holds the frames of all SIDs,
+// they are used in place, Commit / Release hand them over.
+
+#ifndef SID_FRAME_QUEUE_SIZE
+#define SID_FRAME_QUEUE_SIZE 8	// Power of two
+#endif
+
+#ifndef SID_COUNT
+#define SID_COUNT 1
+#endif
+
+class SID_FRAME_QUEUE
+{
+public:
+	SID_FRAME_QUEUE();
+
+	// Core 0, frames of slot for sid[0 .. SID_COUNT-1], 0 = full
+	SID_FRAME* Free();
+	void Commit();
+
+	// Core 1, 0 = empty
+	const SID_FRAME* Next();
+	void Release();
+
+	SID_FRAME frame[SID_FRAME_QUEUE_SIZE][SID_COUNT];
+	volatile uint32_t head;		// Written by core 0
+	volatile uint32_t tail;		// Written by core 1
+
+	volatile uint32_t underruns;
+};
+
+inline SID_FRAME_QUEUE::SID_FRAME_QUEUE()
+{
+	head = tail = 0;
+	underruns = 0;
+}
+
+inline SID_FRAME* SID_FRAME_QUEUE::Free()
+{
+	if (((head + 1) & (SID_FRAME_QUEUE_SIZE - 1)) == tail)
+		return 0;
+
+	return frame[head];
+}
+
+inline void SID_FRAME_QUEUE::Commit()
+{
+	__sync_synchronize();	// Frame before head
+	head = (head + 1) & (SID_FRAME_QUEUE_SIZE - 1);
+}
+
+inline const SID_FRAME* SID_FRAME_QUEUE::Next()
+{
+	if (tail == head)
+	{
+		underruns++;
+		return 0;
+	}
+
+	__sync_synchronize();	// Head before frame
+	return frame[tail];
+}
+
+inline void SID_FRAME_QUEUE::Release()
+{
+	__sync_synchronize();	// Frame read before tail
+	tail = (tail + 1) & (SID_FRAME_QUEUE_SIZE - 1);
+}
+
+#endif // SID_FRAME_QUEUE_CLASS_H
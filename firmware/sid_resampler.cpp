@@ -0,0 +1,140 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: sid_resampler.cpp                     //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+// The template used was resid:                 //
+// https://github.com/libsidplayfp/resid        //
+//                                              //
+//////////////////////////////////////////////////
+
+#include <math.h>
+
+#include "./sid_resampler.h"
+
+// ----------------------------------------------------------------------------
+// I0() computes the 0th order modified Bessel function of the first kind.
+// This function is originally from resample-1.5/filterkit.c by J. O. Smith.
+// ----------------------------------------------------------------------------
+static double I0(double x)
+{
+	// Max error acceptable in I0.
+	const double I0e = 1e-6;
+
+	double sum, u, halfx, temp;
+	int n;
+
+	sum = u = n = 1;
+	halfx = x/2.0;
+
+	do {
+		temp = halfx/n++;
+		u *= temp*temp;
+		sum += u;
+	} while (u >= I0e*sum);
+
+	return sum;
+}
+
+SID_RESAMPLER::SID_RESAMPLER()
+{
+	mode = RESAMPLER_OFF;
+	decimation = 1;
+	fir_n = 0;
+
+	Reset();
+}
+
+SID_RESAMPLER::~SID_RESAMPLER()
+{
+
+}
+
+bool SID_RESAMPLER::Setup(resampler_mode mode, int decimation, double input_freq, double pass_freq)
+{
+	const double pi = 3.1415926535897932385;
+	const double output_freq = input_freq / decimation;
+	double coefficient[RESAMPLER_MAX_TAPS];
+	int n;
+
+	if (mode == RESAMPLER_OFF)
+	{
+		this->mode = mode;
+		this->decimation = 1;
+		fir_n = 0;
+
+		Reset();
+		return true;
+	}
+
+	// The largest coefficient has to fit in a short
+	if (decimation < 2 || 2 * decimation - 1 > RESAMPLER_MAX_TAPS)
+		return false;
+
+	if (mode == RESAMPLER_FIR)
+	{
+		// The pass band must end below half the output rate.
+		if (pass_freq <= 0 || pass_freq >= output_freq / 2)
+			return false;
+
+		// Kaiser window, transition band between the pass band and its alias
+		const double A = RESAMPLER_ATTENUATION;
+		const double dw = 2 * pi * (output_freq - 2 * pass_freq) / input_freq;
+		const double beta = 0.1102*(A - 8.7);
+		const double I0beta = I0(beta);
+
+		n = (int)((A - 7.95)/(2.285*dw) + 0.5);
+		n |= 1;		// Odd, symmetric around the middle tap
+		if (n >= RESAMPLER_MAX_TAPS)
+			return false;
+
+		// Cutoff in the middle of the transition band: half the output rate
+		const double wc = pi / decimation;
+
+		for (int i = 0; i < n; i++)
+		{
+			double x = i - (n - 1) / 2.0;
+			double t = 2 * x / (n - 1);
+			double sinc = x ? sin(wc * x) / (pi * x) : wc / pi;
+			coefficient[i] = sinc * I0(beta*sqrt(1 - t*t)) / I0beta;
+		}
+	}
+	else
+	{
+		n = 2 * decimation - 1;
+		for (int i = 0; i < n; i++)
+			coefficient[i] = decimation - (i < decimation ? decimation - 1 - i : i - decimation + 1);
+	}
+
+	// Gain 1, the rounding error is put on the middle tap
+	double sum = 0;
+	for (int i = 0; i < n; i++)
+		sum += coefficient[i];
+
+	int fixed_sum = 0;
+	for (int i = 0; i < n; i++)
+	{
+		fir[i] = (short)floor(coefficient[i] / sum * (1 << RESAMPLER_SHIFT) + 0.5);
+		fixed_sum += fir[i];
+	}
+	fir[n / 2] += (1 << RESAMPLER_SHIFT) - fixed_sum;
+
+	this->mode = mode;
+	this->decimation = decimation;
+	fir_n = n;
+
+	Reset();
+	return true;
+}
+
+void SID_RESAMPLER::Reset()
+{
+	for (int i = 0; i < RESAMPLER_MAX_TAPS * 2; i++)
+		buffer[i] = 0;
+
+	buffer_pos = 0;
+}
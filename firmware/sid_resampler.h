@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: sid_resampler.h                       //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+// The template used was resid:                 //
+// https://github.com/libsidplayfp/resid        //
+//                                              //
+//////////////////////////////////////////////////
+
+#ifndef SID_RESAMPLER_CLASS_H
+#define SID_RESAMPLER_CLASS_H
+
+#include <stdint.h>
+
+#include "./pico_sid_defs.h"
+
+// Bandlimited decimation of the SID output to the audio sample rate.
+// The output after each step (e.g. every 6 cycles) is taken as input, every
+// decimation inputs one audio sample is taken. The FIR is only calculated
+// for the output samples (polyphase decimator), the inputs are just stored.
+//
+// RESAMPLER_FIR:  Kaiser windowed sinc like the resampling of reSID, the pass
+//                 band up to pass_freq, the stop band from output rate - pass_freq.
+// RESAMPLER_FAST: Triangle kernel over 2 output samples (linear interpolation
+//                 of the boxcar average), 2 * decimation - 1 taps.
+
+enum resampler_mode {RESAMPLER_OFF, RESAMPLER_FAST, RESAMPLER_FIR};
+
+#define RESAMPLER_MAX_TAPS 256		// Power of two
+#define RESAMPLER_SHIFT 15			// Fixed point of the coefficients
+#define RESAMPLER_ATTENUATION 80.0	// Stop band attenuation in dB
+
+class SID_RESAMPLER
+{
+public:
+	SID_RESAMPLER();
+	~SID_RESAMPLER();
+
+	// input_freq: inputs per second, false if the FIR does not fit.
+	// RESAMPLER_FAST and RESAMPLER_FIR need a decimation of 2 or more.
+	bool Setup(resampler_mode mode, int decimation, double input_freq, double pass_freq);
+	void Reset();
+
+	resampler_mode Mode();
+	int Decimation();
+	int Taps();
+
+	// 16 bit samples
+	void Input(int sample);
+	int Output(int bits);
+
+private:
+	resampler_mode mode;
+	int decimation;
+
+	// Coefficients, the oldest input first
+	short fir[RESAMPLER_MAX_TAPS];
+	int fir_n;
+
+	// Each input is stored twice, the last fir_n inputs are always in one piece
+	short buffer[RESAMPLER_MAX_TAPS * 2];
+	int buffer_pos;
+};
+
+inline resampler_mode SID_RESAMPLER::Mode()
+{
+	return mode;
+}
+
+inline int SID_RESAMPLER::Decimation()
+{
+	return decimation;
+}
+
+inline int SID_RESAMPLER::Taps()
+{
+	return fir_n;
+}
+
+SID_TIME_CRITICAL_INLINE inline void SID_RESAMPLER::Input(int sample)
+{
+	buffer[buffer_pos] = buffer[buffer_pos + RESAMPLER_MAX_TAPS] = sample;
+	buffer_pos = (buffer_pos + 1) & (RESAMPLER_MAX_TAPS - 1);
+}
+
+SID_TIME_CRITICAL_INLINE inline int SID_RESAMPLER::Output(int bits)
+{
+	// The last fir_n inputs end in front of buffer_pos
+	const short* sample = buffer + buffer_pos + RESAMPLER_MAX_TAPS - fir_n;
+	int v = 0;
+
+	for (int i = 0; i < fir_n; i++)
+		v += fir[i] * sample[i];
+
+	v >>= RESAMPLER_SHIFT;
+
+	if (v >= 32767)
+		v = 32767;
+	else if (v < -32768)
+		v = -32768;
+
+	return v >> (16 - bits);
+}
+
+#endif // SID_RESAMPLER_CLASS_H
@@ -27,17 +27,6 @@ void SID_VOICE::SetSidType(sid_type type)
 {
     wave.SetSidType(type);
     envelope.SetSidType(type);
-
-    switch (type) {
-    case MOS_6581:
-        wave_zero = 0x380;
-        break;
-    case MOS_8580:
-        wave_zero = 0x9e0;
-        break;
-    default:
-        break;
-    }
 }
 
 void SID_VOICE::SetSyncSource(SID_VOICE *voice_source)
@@ -51,7 +40,7 @@ void SID_VOICE::Reset()
     envelope.Reset();
 }
 
-void SID_VOICE::WriteControlReg(reg8 value)
+SID_TIME_CRITICAL void SID_VOICE::WriteControlReg(reg8 value)
 {
     wave.WriteControlReg(value);
     envelope.WriteControlReg(value);
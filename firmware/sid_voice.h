@@ -36,9 +36,6 @@ public:
     SID_WAVE wave;
     SID_ENVELOPE envelope;
 
-protected:
-    short wave_zero;
-
 friend class PICO_SID;
 };
 
@@ -77,7 +74,7 @@ friend class PICO_SID;
 
 inline int SID_VOICE::Output()
 {
-    return (wave.Output() - wave_zero) * envelope.Output();
+    return wave.DacOutput() * envelope.Output();
 }
 
 #endif // SID_VOICE_CLASS_H
@@ -13,7 +13,9 @@
 //////////////////////////////////////////////////
 
 #include "./sid_wave.h"
-#include "./sid_dac.h"
+
+#include <stdlib.h>
+#include <string.h>
 
 // Number of cycles after which the shift register is reset
 // when the test bit is set.
@@ -35,89 +37,119 @@ const cycle_count FLOATING_OUTPUT_TTL_BIT_6581   =    1500;
 const cycle_count FLOATING_OUTPUT_TTL_START_8580 = 4400000; // ~5s
 const cycle_count FLOATING_OUTPUT_TTL_BIT_8580   =   50000;
 
-// Waveform lookup tables.
-unsigned short SID_WAVE::model_wave[2][8][1 << 12] = {
+// Combined waveform lookup tables.
+const uint8_t SID_WAVE::model_wave[2][4][1 << 12] = {
     {
-        {0},
-        {0},
-        {0},
 #include "wave6581__ST.h"
-        {0},
 #include "wave6581_P_T.h"
 #include "wave6581_PS_.h"
 #include "wave6581_PST.h"
     },
     {
-        {0},
-        {0},
-        {0},
 #include "wave8580__ST.h"
-        {0},
 #include "wave8580_P_T.h"
 #include "wave8580_PS_.h"
 #include "wave8580_PST.h"
     }
 };
 
-// DAC lookup tables.
-unsigned short SID_WAVE::model_dac[2][1 << 12] = {
+#if SID_WAVE_TABLES_IN_RAM
+uint8_t* SID_WAVE::ram_wave[2] = {0, 0};
+#endif
+
+// DAC lookup tables for 12-bit DACs, built at compile time.
+// MOS 6581: 2R/R ~ 2.20, missing termination resistor.
+// MOS 8580: 2R/R ~ 2.00, correct termination.
+static constexpr SID_DAC_TABLE<12> model_dac_6581 = BuildDacTable<12>(2.20, false);
+static constexpr SID_DAC_TABLE<12> model_dac_8580 = BuildDacTable<12>(2.00, true);
+
+SID_TIME_CRITICAL_TABLE const SID_DAC_TABLE<12> SID_WAVE::model_dac[2] = {
+    model_dac_6581,
+    model_dac_8580,
+};
+
+// Waveform and DAC lookup tables merged, built on the first use of a model.
+// Index 2 (sawtooth) is the DAC table itself, 0 and 4 are not needed.
+short* SID_WAVE::model_dac_wave[2][8] = {
     {0},
     {0},
 };
+bool SID_WAVE::model_init[2] = {false, false};
 
+static constexpr reg12 NoiseOutput(reg24 shift_register)
+{
+    return
+        ((shift_register & 0x100000) >> 9) |
+        ((shift_register & 0x040000) >> 8) |
+        ((shift_register & 0x004000) >> 5) |
+        ((shift_register & 0x000800) >> 3) |
+        ((shift_register & 0x000200) >> 2) |
+        ((shift_register & 0x000020) << 1) |
+        ((shift_register & 0x000004) << 3) |
+        ((shift_register & 0x000001) << 4);
+}
 
-SID_WAVE::SID_WAVE()
+// Noise output per byte of the shift register
+static constexpr SID_NOISE_TABLE BuildNoiseTable()
 {
-    static bool class_init = false;
+    SID_NOISE_TABLE table = {};
 
-    if (!class_init)
-    {
-        // Calculate tables for normal waveforms.
-        accumulator = 0;
-        for (int i = 0; i < (1 << 12); i++) {
-            reg24 msb = accumulator & 0x800000;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 256; j++)
+            table.value[i][j] = NoiseOutput(j << (i * 8));
 
-            // Noise mask, triangle, sawtooth, pulse mask.
-            // The triangle calculation is made branch-free, just for the hell of it.
-            model_wave[0][0][i] = model_wave[1][0][i] = 0xfff;
-            model_wave[0][1][i] = model_wave[1][1][i] = ((accumulator ^ -!!msb) >> 11) & 0xffe;
-            model_wave[0][2][i] = model_wave[1][2][i] = accumulator >> 12;
-            model_wave[0][4][i] = model_wave[1][4][i] = 0xfff;
+    return table;
+}
 
-            accumulator += 0x1000;
-        }
+static constexpr SID_NOISE_TABLE noise_table_init = BuildNoiseTable();
+SID_TIME_CRITICAL_TABLE const SID_NOISE_TABLE SID_WAVE::noise_table = noise_table_init;
 
-        // Build DAC lookup tables for 12-bit DACs.
-        // MOS 6581: 2R/R ~ 2.20, missing termination resistor.
-        BuildDacTable(model_dac[0], 12, 2.20, false);
-        // MOS 8580: 2R/R ~ 2.00, correct termination.
-        BuildDacTable(model_dac[1], 12, 2.00, true);
-
-        unsigned short max0 = model_dac[0][0];
-        unsigned short min0 = model_dac[0][0];
-
-        unsigned short max1 = model_dac[1][0];
-        unsigned short min1 = model_dac[1][0];
-
-        for(int i=1; i<(1<<12); i++)
-        {
-            if(max0 < model_dac[0][i])
-                max0 = model_dac[0][i];
-            if(min0 > model_dac[0][i])
-                min0 = model_dac[0][i];
-
-            if(max1 < model_dac[1][i])
-                max1 = model_dac[1][i];
-            if(min1 > model_dac[1][i])
-                min1 = model_dac[1][i];
-        }
+void SID_WAVE::ModelInit(sid_type type)
+{
+    // A failed malloc is not retried on every SetSidType
+    if (model_init[type])
+        return;
 
-        class_init = true;
+    model_init[type] = true;
+
+#if SID_WAVE_TABLES_IN_RAM
+    uint8_t* ram = (uint8_t*)malloc(sizeof(model_wave[type]));
+    if (ram)
+    {
+        memcpy(ram, model_wave[type], sizeof(model_wave[type]));
+        __sync_synchronize();	// Table before pointer
+        ram_wave[type] = ram;
     }
+#endif
 
+    BuildDacWaveTables(type);
+}
+
+void SID_WAVE::ModelFree(sid_type type)
+{
+    short** tables = model_dac_wave[type];
+
+    // Plane 1 is the start of the block
+    short* block = tables[1];
+    for (int i = 0; i < 8; i++)
+        tables[i] = 0;
+    free(block);
+
+#if SID_WAVE_TABLES_IN_RAM
+    free(ram_wave[type]);
+    ram_wave[type] = 0;
+#endif
+
+    model_init[type] = false;
+}
+
+SID_WAVE::SID_WAVE()
+{
     sync_source = this;
 
     sid_model = MOS_6581;
+    wave_zero = 0x380;
+    waveform = 0;
 
     // Accumulator's even bits are high on powerup
     accumulator = 0x555555;
@@ -129,13 +161,125 @@ SID_WAVE::SID_WAVE()
 
 SID_WAVE::~SID_WAVE()
 {
-
 }
 
 void SID_WAVE::SetSidType(sid_type type)
 {
     sid_model = type;
-    wave = model_wave[type][waveform & 0x7];
+
+    ModelInit(type);
+
+    SetWaveTable();
+
+    // DC offset of the waveform DAC
+    wave_zero = (type == MOS_6581) ? 0x380 : 0x9e0;
+
+    SetDacWave();
+    SetDacOutput();
+}
+
+void SID_WAVE::BuildDacWaveTables(sid_type type)
+{
+    static const int planes[6] = {1, 2, 3, 5, 6, 7};
+    const short zero = (type == MOS_6581) ? 0x380 : 0x9e0;
+
+    // 48 KB per model, without it the voices use model_dac
+    short* tables = (short*)malloc(6 * (1 << 12) * sizeof(short));
+    if (!tables)
+        return;
+
+    for (int p = 0; p < 6; p++) {
+        short* table = tables + p * (1 << 12);
+
+        for (int i = 0; i < (1 << 12); i++)
+            table[i] = model_dac[type][ModelWaveOutput(type, planes[p], i)] - zero;
+    }
+
+    // SetDacWave tests plane 2, it is published last
+    for (int p = 0; p < 6; p++)
+        if (planes[p] != 2)
+            model_dac_wave[type][planes[p]] = tables + p * (1 << 12);
+    __sync_synchronize();
+    model_dac_wave[type][2] = tables + 1 * (1 << 12);
+}
+
+SID_TIME_CRITICAL void SID_WAVE::SetWaveTable()
+{
+    reg8 plane = waveform & 0x7;
+
+    wave_sampled = 0;
+    wave_xor = 0;
+    wave_shift = 0;
+    wave_and = 0;
+    wave_or = 0;
+
+    switch (plane) {
+    case 0x1:
+        // Triangle
+        wave_xor = 0xfff;
+        wave_shift = 1;
+        wave_and = 0xffe;
+        break;
+    case 0x2:
+        // Sawtooth
+        wave_and = 0xfff;
+        break;
+    case 0x0:
+    case 0x4:
+        // Noise mask / Pulse mask
+        wave_or = 0xfff;
+        break;
+    default:
+        // Combined waveforms
+        const uint8_t* tables = model_wave[sid_model][0];
+#if SID_WAVE_TABLES_IN_RAM
+        if (ram_wave[sid_model])
+            tables = ram_wave[sid_model];
+#endif
+        wave_sampled = tables + ((plane == 0x3) ? 0 : plane - 0x4) * (1 << 12);
+        break;
+    }
+}
+
+
+reg12 SID_WAVE::ModelWaveOutput(sid_type type, reg8 waveform, int ix)
+{
+    switch (waveform & 0x7) {
+    case 0x1:
+        return ((ix ^ (-(ix >> 11) & 0xfff)) << 1) & 0xffe;
+    case 0x2:
+        return ix;
+    case 0x0:
+    case 0x4:
+        return 0xfff;
+    case 0x3:
+        return model_wave[type][0][ix] << 4;
+    default:
+        return model_wave[type][(waveform & 0x7) - 0x4][ix] << 4;
+    }
+}
+
+SID_TIME_CRITICAL void SID_WAVE::SetDacWave()
+{
+    short** tables = model_dac_wave[sid_model];
+
+    dac_index_set = 0;
+
+    if (!waveform || (waveform & 0x8) || !tables[2])
+    {
+        // Noise and floating DAC input go through model_dac
+        dac_wave = 0;
+    }
+    else if (waveform == 0x4)
+    {
+        // Pulse alone is 0xfff, the index is forced to it
+        dac_wave = tables[2];
+        dac_index_set = 0xfff;
+    }
+    else
+    {
+        dac_wave = tables[waveform];
+    }
 }
 
 void SID_WAVE::SetSyncSource(SID_WAVE *wave_source)
@@ -149,6 +293,7 @@ void SID_WAVE::Reset()
     // accumulator is not changed on reset
     freq = 0;
     pw = 0;
+    msb_next_cycles = 0;
 
     msb_rising = false;
 
@@ -157,7 +302,7 @@ void SID_WAVE::Reset()
     ring_mod = 0;
     sync = 0;
 
-    wave = model_wave[sid_model][0];
+    SetWaveTable();
 
     ring_msb_mask = 0;
     no_noise = 0xfff;
@@ -175,26 +320,31 @@ void SID_WAVE::Reset()
     waveform_output = 0;
     osc3 = 0;
     floating_output_ttl = 0;
+
+    SetDacWave();
+    SetDacOutput();
 }
 
-void SID_WAVE::WriteFreqLo(reg8 value)
+SID_TIME_CRITICAL void SID_WAVE::WriteFreqLo(reg8 value)
 {
     freq = (freq & 0xff00) | (value & 0x00ff);
+    msb_next_cycles = 0;
 }
 
-void SID_WAVE::WriteFreqHi(reg8 value)
+SID_TIME_CRITICAL void SID_WAVE::WriteFreqHi(reg8 value)
 {
     freq = ((value << 8) & 0xff00) | (freq & 0x00ff);
+    msb_next_cycles = 0;
 }
 
-void SID_WAVE::WritePwLo(reg8 value)
+SID_TIME_CRITICAL void SID_WAVE::WritePwLo(reg8 value)
 {
     pw = (pw & 0xf00) | (value & 0x0ff);
     // Push next pulse level into pulse level pipeline.
     pulse_output = (accumulator >> 12) >= pw ? 0xfff : 0x000;
 }
 
-void SID_WAVE::WritePwHi(reg8 value)
+SID_TIME_CRITICAL void SID_WAVE::WritePwHi(reg8 value)
 {
     pw = ((value << 8) & 0xf00) | (pw & 0x0ff);
     // Push next pulse level into pulse level pipeline.
@@ -224,7 +374,7 @@ bool DoPreWriteback(reg8 waveform_prev, reg8 waveform, bool is6581)
     return true;
 }
 
-void SID_WAVE::WriteControlReg(reg8 value)
+SID_TIME_CRITICAL void SID_WAVE::WriteControlReg(reg8 value)
 {
     reg8 waveform_prev = waveform;
     reg8 test_prev = test;
@@ -234,7 +384,8 @@ void SID_WAVE::WriteControlReg(reg8 value)
     sync = value & 0x02;
 
     // Set up waveform table.
-    wave = model_wave[sid_model][waveform & 0x7];
+    SetWaveTable();
+    SetDacWave();
 
     // Substitution of accumulator MSB when sawtooth = 0, ring_mod = 1.
     ring_msb_mask = ((~value >> 5) & (value >> 2) & 0x1) << 23;
@@ -255,6 +406,7 @@ void SID_WAVE::WriteControlReg(reg8 value)
     if (!test_prev && test) {
         // Reset accumulator.
         accumulator = 0;
+        msb_next_cycles = 0;
 
         // Flush shift pipeline.
         shift_pipeline = 0;
@@ -301,6 +453,7 @@ void SID_WAVE::WaveBitfade()
 {
     waveform_output &= waveform_output >> 1;
     osc3 = waveform_output;
+    SetDacOutput();
     if (waveform_output != 0)
         floating_output_ttl = (sid_model == MOS_6581) ? FLOATING_OUTPUT_TTL_BIT_6581 : FLOATING_OUTPUT_TTL_BIT_8580;
 }
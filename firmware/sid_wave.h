@@ -18,6 +18,18 @@
 #include <stdint.h>
 
 #include "./pico_sid_defs.h"
+#include "./sid_dac.h"
+
+// Noise output of the three bytes of the shift register
+struct SID_NOISE_TABLE
+{
+    unsigned short value[3][256];
+
+    constexpr const unsigned short* operator[](int i) const
+    {
+        return value[i];
+    }
+};
 
 class SID_WAVE
 {
@@ -25,12 +37,24 @@ public:
     SID_WAVE();
     ~SID_WAVE();
 
+    // Builds the merged tables of a model (and the SRAM copy of the
+    // combined waveforms), once. SetSidType calls it as well, the firmware
+    // calls it first outside of the IRQs. Without memory the voices use model_dac.
+    static void ModelInit(sid_type type);
+    // Frees the tables of a model no instance uses any more
+    static void ModelFree(sid_type type);
+
     void SetSidType(sid_type type);
     void SetSyncSource(SID_WAVE* wave_source);
     void Reset();
 
+    // Single cycle with the pipeline delays, a SID is clocked either
+    // this way (with SetWaveformOutput()) or by delta_t from Reset() on
+    void Clock();
     void Clock(int delta_t);
     void Synchronize();
+    // Cycles up to the next flip of the accumulator MSB (freq != 0)
+    cycle_count MsbNextCycles();
 
     void WriteFreqLo(reg8 value);
     void WriteFreqHi(reg8 value);
@@ -42,16 +66,24 @@ public:
     reg12 OutWaveform();
 
     short Output();
+    short DacOutput();
 
     void SetWaveformOutput();
     void SetWaveformOutput(cycle_count delta_t);
 
 protected:
-    void ClockShiftRegister();
+    void ClockShiftRegister(int shifts = 1);
     void WriteShiftRegister();
     void SetNoiseOutput();
     void WaveBitfade();
     void ShiftregBitfade();
+    void SetDacWave();
+    void SetDacOutput();
+    static void BuildDacWaveTables(sid_type type);
+
+    void SetWaveTable();
+    reg12 WaveOutput(int ix);
+    static reg12 ModelWaveOutput(sid_type type, reg8 waveform, int ix);
 
     const SID_WAVE* sync_source;
     SID_WAVE* sync_dest;
@@ -60,6 +92,8 @@ protected:
 
 
     bool msb_rising;
+    // Cache of MsbNextCycles(), 0 = to be calculated
+    cycle_count msb_next_cycles;
     reg24 freq;
     reg12 pw;
 
@@ -71,6 +105,7 @@ protected:
     reg24 ring_msb_mask;
     unsigned short no_noise;
     unsigned short noise_output;
+    static const SID_NOISE_TABLE noise_table;
     unsigned short no_noise_or_noise_output;
     unsigned short no_pulse;
     unsigned short pulse_output;
@@ -85,21 +120,83 @@ protected:
     reg12 waveform_output;
     cycle_count floating_output_ttl;
 
+    // DAC output of waveform_output minus wave_zero
+    short dac_output;
+    short wave_zero;
+
+    // Non noise waveforms: accumulator index -> DAC output minus wave_zero.
+    // All tables output 0 at index 0, so the pulse can mask the index.
+    const short* dac_wave;
+    reg12 dac_index_set;
+
     sid_type sid_model;
 
-    unsigned short* wave;
-    static unsigned short model_wave[2][8][1 << 12];
-    static unsigned short model_dac[2][1 << 12];
+    // Waveform of the accumulator index, see WaveOutput()
+    const uint8_t* wave_sampled;
+    reg12 wave_xor;
+    reg12 wave_shift;
+    reg12 wave_and;
+    reg12 wave_or;
+
+    // Combined waveforms ST, P_T, PS_ and PST (8 bit OSC3 samples)
+    static const uint8_t model_wave[2][4][1 << 12];
+
+#if SID_WAVE_TABLES_IN_RAM
+    // SRAM copy of model_wave for the models in use
+    static uint8_t* ram_wave[2];
+#endif
+    static const SID_DAC_TABLE<12> model_dac[2];
+    static short* model_dac_wave[2][8];
+    static bool model_init[2];
 
     friend class SID_VOICE;
     friend class PICO_SID;
 };
 
+// ----------------------------------------------------------------------------
+// SID clocking - 1 cycle.
+// ----------------------------------------------------------------------------
+
+SID_TIME_CRITICAL_INLINE inline void SID_WAVE::Clock()
+{
+    if (unlikely(test)) {
+        // Count down time to fully reset shift register.
+        if (unlikely(shift_register_reset) && unlikely(!--shift_register_reset)) {
+            ShiftregBitfade();
+        }
+
+        // The test bit sets pulse high.
+        pulse_output = 0xfff;
+    }
+    else {
+        // Calculate new accumulator value;
+        reg24 accumulator_next = (accumulator + freq) & 0xffffff;
+        reg24 accumulator_bits_set = ~accumulator & accumulator_next;
+        accumulator = accumulator_next;
+
+        // Check whether the MSB is set high. This is used for synchronization.
+        msb_rising = (accumulator_bits_set & 0x800000) ? true : false;
+
+        // Not counted down per cycle, calculated again for delta_t clocking.
+        msb_next_cycles = 0;
+
+        // Shift noise register once for each time accumulator bit 19 is set high.
+        // The shift is delayed 2 cycles.
+        if (unlikely(accumulator_bits_set & 0x080000)) {
+            // Pipeline: Detect rising bit, shift phase 1, shift phase 2.
+            shift_pipeline = 2;
+        }
+        else if (unlikely(shift_pipeline) && !--shift_pipeline) {
+            ClockShiftRegister();
+        }
+    }
+}
+
 // ----------------------------------------------------------------------------
 // SID clocking - delta_t cycles.
 // ----------------------------------------------------------------------------
 
-inline void SID_WAVE::Clock(cycle_count delta_t)
+SID_TIME_CRITICAL_INLINE inline void SID_WAVE::Clock(cycle_count delta_t)
 {
     if (unlikely(test)) {
         // Count down time to fully reset shift register.
@@ -122,44 +219,31 @@ inline void SID_WAVE::Clock(cycle_count delta_t)
         reg24 delta_accumulator = delta_t*freq;
         reg24 accumulator_next = (accumulator + delta_accumulator) & 0xffffff;
         reg24 accumulator_bits_set = ~accumulator & accumulator_next;
+
+        // Shift noise register once for each time accumulator bit 19 is set high.
+        // Bit 19 is set high at 0x080000 + n * 0x100000, the count is taken from
+        // the sum without the wrap around.
+        int shifts = ((accumulator + delta_accumulator + 0x080000) >> 20) - ((accumulator + 0x080000) >> 20);
+
         accumulator = accumulator_next;
 
         // Check whether the MSB is set high. This is used for synchronization.
         msb_rising = (accumulator_bits_set & 0x800000) ? true : false;
 
+        // Count down the cycles up to the next MSB flip, calculated again behind it.
+        if (likely(delta_t < msb_next_cycles)) {
+            msb_next_cycles -= delta_t;
+        }
+        else {
+            msb_next_cycles = 0;
+        }
+
         // NB! Any pipelined shift register clocking from single cycle clocking
         // will be lost. It is not worth the trouble to flush the pipeline here.
 
-        // Shift noise register once for each time accumulator bit 19 is set high.
-        // Bit 19 is set high each time 2^20 (0x100000) is added to the accumulator.
-        reg24 shift_period = 0x100000;
-
-        while (delta_accumulator) {
-            if (likely(delta_accumulator < shift_period)) {
-                shift_period = delta_accumulator;
-                // Determine whether bit 19 is set on the last period.
-                // NB! Requires two's complement integer.
-                if (likely(shift_period <= 0x080000)) {
-                    // Check for flip from 0 to 1.
-                    if (((accumulator - shift_period) & 0x080000) || !(accumulator & 0x080000))
-                    {
-                        break;
-                    }
-                }
-                else {
-                    // Check for flip from 0 (to 1 or via 1 to 0) or from 1 via 0 to 1.
-                    if (((accumulator - shift_period) & 0x080000) && !(accumulator & 0x080000))
-                    {
-                        break;
-                    }
-                }
-            }
-
-            // Shift the noise/random register.
-            // NB! The two-cycle pipeline delay is only modeled for 1 cycle clocking.
-           ClockShiftRegister();
-
-            delta_accumulator -= shift_period;
+        // NB! The two-cycle pipeline delay is only modeled for 1 cycle clocking.
+        if (unlikely(shifts)) {
+            ClockShiftRegister(shifts);
         }
 
         // Calculate pulse high/low.
@@ -175,16 +259,38 @@ inline void SID_WAVE::Clock(cycle_count delta_t)
 // MSB is set high for hard sync to operate correctly. See SID::clock().
 // ----------------------------------------------------------------------------
 
-inline void SID_WAVE::Synchronize()
+SID_TIME_CRITICAL_INLINE inline void SID_WAVE::Synchronize()
 {
     // A special case occurs when a sync source is synced itself on the same
     // cycle as when its MSB is set high. In this case the destination will
     // not be synced. This has been verified by sampling OSC3.
     if (unlikely(msb_rising) && sync_dest->sync && !(sync && sync_source->msb_rising)) {
         sync_dest->accumulator = 0;
+        sync_dest->msb_next_cycles = 0;
     }
 }
 
+// ----------------------------------------------------------------------------
+// Cycles up to the next flip of the MSB, the oscillators must be clocked
+// exactly on the cycle when the MSB is set high for hard sync.
+// Only calculated again after the flip or a change of freq or accumulator.
+// ----------------------------------------------------------------------------
+
+SID_TIME_CRITICAL_INLINE inline cycle_count SID_WAVE::MsbNextCycles()
+{
+    if (unlikely(!msb_next_cycles)) {
+        reg24 delta_accumulator =
+            (accumulator & 0x800000 ? 0x1000000 : 0x800000) - accumulator;
+
+        msb_next_cycles = delta_accumulator/freq;
+        if (likely(delta_accumulator%freq)) {
+            ++msb_next_cycles;
+        }
+    }
+
+    return msb_next_cycles;
+}
+
 // ----------------------------------------------------------------------------
 // Waveform output.
 // The output from SID 8580 is delayed one cycle compared to SID 6581;
@@ -239,17 +345,23 @@ inline void SID_WAVE::Synchronize()
 // The low 4 waveform bits are zero (grounded).
 //
 
-inline void SID_WAVE::ClockShiftRegister()
+SID_TIME_CRITICAL_INLINE inline void SID_WAVE::ClockShiftRegister(int shifts)
 {
     // bit0 = (bit22 | test) ^ bit17
-    reg24 bit0 = ((shift_register >> 22) ^ (shift_register >> 17)) & 0x1;
-    shift_register = ((shift_register << 1) | bit0) & 0x7fffff;
+    // For up to 18 shifts all feedback bits are taken from the register
+    // before the shifts: bit n = bit (23 - shifts + n) ^ bit (18 - shifts + n)
+    while (shifts > 0) {
+        int count = shifts < 18 ? shifts : 18;
+        reg24 bits = ((shift_register >> (23 - count)) ^ (shift_register >> (18 - count))) & ((1 << count) - 1);
+        shift_register = ((shift_register << count) | bits) & 0x7fffff;
+        shifts -= count;
+    }
 
     // New noise waveform output.
     SetNoiseOutput();
 }
 
-inline void SID_WAVE::WriteShiftRegister()
+SID_TIME_CRITICAL_INLINE inline void SID_WAVE::WriteShiftRegister()
 {
     // Write changes to the shift register output caused by combined waveforms
     // back into the shift register.
@@ -272,17 +384,12 @@ inline void SID_WAVE::WriteShiftRegister()
     no_noise_or_noise_output = no_noise | noise_output;
 }
 
-inline void SID_WAVE::SetNoiseOutput()
+SID_TIME_CRITICAL_INLINE inline void SID_WAVE::SetNoiseOutput()
 {
     noise_output =
-        ((shift_register & 0x100000) >> 9) |
-        ((shift_register & 0x040000) >> 8) |
-        ((shift_register & 0x004000) >> 5) |
-        ((shift_register & 0x000800) >> 3) |
-        ((shift_register & 0x000200) >> 2) |
-        ((shift_register & 0x000020) << 1) |
-        ((shift_register & 0x000004) << 3) |
-        ((shift_register & 0x000001) << 4);
+        noise_table[0][shift_register & 0xff] |
+        noise_table[1][(shift_register >> 8) & 0xff] |
+        noise_table[2][(shift_register >> 16) & 0x7f];
 
     no_noise_or_noise_output = no_noise | noise_output;
 }
@@ -366,6 +473,20 @@ inline void SID_WAVE::SetNoiseOutput()
 // since the waveform bits are and'ed into the shift register via the shift
 // register outputs.
 
+// Only the combined waveforms are stored (as 8 bit OSC3 samples), the others
+// are calculated from the index:
+// Triangle: (ix ^ (msb ? 0xfff : 0)) << 1 & 0xffe
+// Sawtooth: ix
+// Pulse / Noise mask: 0xfff
+
+SID_TIME_CRITICAL_INLINE inline reg12 SID_WAVE::WaveOutput(int ix)
+{
+    if (wave_sampled)
+        return wave_sampled[ix] << 4;
+
+    return (((ix ^ (-(ix >> 11) & wave_xor)) << wave_shift) & wave_and) | wave_or;
+}
+
 static reg12 NoisePulse6581(reg12 noise)
 {
     return (noise < 0xf00) ? 0x000 : noise & (noise<<1) & (noise<<2);
@@ -376,7 +497,7 @@ static reg12 NoisePulse8580(reg12 noise)
     return (noise < 0xfc0) ? noise & (noise << 1) : 0xfc0;
 }
 
-inline void SID_WAVE::SetWaveformOutput()
+SID_TIME_CRITICAL_INLINE inline void SID_WAVE::SetWaveformOutput()
 {
     // Set output value.
     if (likely(waveform)) {
@@ -384,7 +505,7 @@ inline void SID_WAVE::SetWaveformOutput()
         // calculation of the output value.
         int ix = (accumulator ^ (~sync_source->accumulator & ring_msb_mask)) >> 12;
 
-        waveform_output = wave[ix] & (no_pulse | pulse_output) & no_noise_or_noise_output;
+        waveform_output = WaveOutput(ix) & (no_pulse | pulse_output) & no_noise_or_noise_output;
 
         if (unlikely((waveform & 0xc) == 0xc))
         {
@@ -392,13 +513,18 @@ inline void SID_WAVE::SetWaveformOutput()
                                   NoisePulse6581(waveform_output) : NoisePulse8580(waveform_output);
         }
 
+        if (likely(dac_wave))
+            dac_output = dac_wave[(ix | dac_index_set) & (no_pulse | pulse_output)];
+        else
+            SetDacOutput();
+
         // Triangle/Sawtooth output is delayed half cycle on 8580.
         // This will appear as a one cycle delay on OSC3 as it is
         // latched in the first phase of the clock.
         if ((waveform & 3) && (sid_model == MOS_8580))
         {
             osc3 = tri_saw_pipeline & (no_pulse | pulse_output) & no_noise_or_noise_output;
-            tri_saw_pipeline = wave[ix];
+            tri_saw_pipeline = WaveOutput(ix);
         }
         else
         {
@@ -438,7 +564,7 @@ inline void SID_WAVE::SetWaveformOutput()
     pulse_output = -((accumulator >> 12) >= pw) & 0xfff;
 }
 
-inline void SID_WAVE::SetWaveformOutput(cycle_count delta_t)
+SID_TIME_CRITICAL_INLINE inline void SID_WAVE::SetWaveformOutput(cycle_count delta_t)
 {
     // Set output value.
     if (likely(waveform)) {
@@ -446,7 +572,14 @@ inline void SID_WAVE::SetWaveformOutput(cycle_count delta_t)
         // calculation of the output value.
         int ix = (accumulator ^ (~sync_source->accumulator & ring_msb_mask)) >> 12;
         waveform_output =
-            wave[ix] & (no_pulse | pulse_output) & no_noise_or_noise_output;
+            WaveOutput(ix) & (no_pulse | pulse_output) & no_noise_or_noise_output;
+
+        // Without noise the DAC output comes straight from the accumulator index
+        if (likely(dac_wave))
+            dac_output = dac_wave[(ix | dac_index_set) & (no_pulse | pulse_output)];
+        else
+            SetDacOutput();
+
         // Triangle/Sawtooth output delay for the 8580 is not modeled
         osc3 = waveform_output;
 
@@ -468,6 +601,7 @@ inline void SID_WAVE::SetWaveformOutput(cycle_count delta_t)
             if (unlikely(floating_output_ttl <= 0)) {
                 floating_output_ttl = 0;
                 osc3 = waveform_output = 0;
+                SetDacOutput();
             }
         }
     }
@@ -514,4 +648,16 @@ inline short SID_WAVE::Output()
     return model_dac[sid_model][waveform_output];
 }
 
+SID_TIME_CRITICAL_INLINE inline void SID_WAVE::SetDacOutput()
+{
+    dac_output = model_dac[sid_model][waveform_output] - wave_zero;
+}
+
+// DAC output without the DC offset of the waveform DAC (Output() - wave_zero),
+// it is updated with every change of waveform_output.
+inline short SID_WAVE::DacOutput()
+{
+    return dac_output;
+}
+
 #endif // SID_WAVE_CLASS_H
@@ -124,7 +124,7 @@
 // ----------------------------------------------------------------------------
 // Calculation of coefficients.
 // ----------------------------------------------------------------------------
-inline
+constexpr
 void cubic_coefficients(double x1, double y1, double x2, double y2,
 			double k1, double k2,
 			double& a, double& b, double& c, double& d)
@@ -141,12 +141,12 @@ void cubic_coefficients(double x1, double y1, double x2, double y2,
 // Evaluation of cubic polynomial by brute force.
 // ----------------------------------------------------------------------------
 template<class PointPlotter>
-inline
+constexpr
 void interpolate_brute_force(double x1, double y1, double x2, double y2,
 			     double k1, double k2,
 			     PointPlotter plot, double res)
 {
-  double a, b, c, d;
+  double a = 0, b = 0, c = 0, d = 0;
   cubic_coefficients(x1, y1, x2, y2, k1, k2, a, b, c, d);
   
   // Calculate each point.
@@ -160,12 +160,12 @@ void interpolate_brute_force(double x1, double y1, double x2, double y2,
 // Evaluation of cubic polynomial by forward differencing.
 // ----------------------------------------------------------------------------
 template<class PointPlotter>
-inline
+constexpr
 void interpolate_forward_difference(double x1, double y1, double x2, double y2,
 				    double k1, double k2,
 				    PointPlotter plot, double res)
 {
-  double a, b, c, d;
+  double a = 0, b = 0, c = 0, d = 0;
   cubic_coefficients(x1, y1, x2, y2, k1, k2, a, b, c, d);
   
   double y = ((a*x1 + b)*x1 + c)*x1 + d;
@@ -181,14 +181,14 @@ void interpolate_forward_difference(double x1, double y1, double x2, double y2,
 }
 
 template<class PointIter>
-inline
+constexpr
 double x(PointIter p)
 {
   return (*p)[0];
 }
 
 template<class PointIter>
-inline
+constexpr
 double y(PointIter p)
 {
   return (*p)[1];
@@ -203,10 +203,10 @@ double y(PointIter p)
 // introduced by repeating points.
 // ----------------------------------------------------------------------------
 template<class PointIter, class PointPlotter>
-inline
+constexpr
 void interpolate(PointIter p0, PointIter pn, PointPlotter plot, double res)
 {
-  double k1, k2;
+  double k1 = 0, k2 = 0;
 
   // Set up points for first curve segment.
   PointIter p1 = p0; ++p1;
@@ -253,11 +253,11 @@ class PointPlotter
   F* f;
 
  public:
-  PointPlotter(F* arr) : f(arr)
+  constexpr PointPlotter(F* arr) : f(arr)
   {
   }
 
-  void operator ()(double x, double y)
+  constexpr void operator ()(double x, double y)
   {
     // Clamp negative values to zero.
     if (y < 0) {
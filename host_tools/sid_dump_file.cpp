@@ -0,0 +1,92 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: sid_dump_file.cpp                     //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+#include "./sid_dump_file.h"
+#include "./sid_stream_file.h"
+
+#include <cstdio>
+#include <cstring>
+
+bool LoadSidDump(const char* filename, std::vector<SID_DUMP_WRITE>& writes)
+{
+    writes.clear();
+
+    FILE* file = fopen(filename, "rb");
+    if (file == NULL)
+        return false;
+
+    char id[8];
+    if (fread(id, 1, 8, file) != 8)
+    {
+        fclose(file);
+        return false;
+    }
+
+    if (memcmp(id, SID_STREAM_ID, 8) == 0)
+    {
+        fclose(file);
+
+        SID_STREAM_READER stream;
+        if (!stream.Open(filename))
+            return false;
+
+        writes.reserve(stream.WriteCount());
+
+        SID_DUMP_WRITE write;
+        while (stream.Next(write))
+            writes.push_back(write);
+
+        return !writes.empty();
+    }
+
+    if (memcmp(id, "SID_DUMP", 8) != 0)
+    {
+        fclose(file);
+        return false;
+    }
+
+    std::vector<uint8_t> dump;
+    uint8_t buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        dump.insert(dump.end(), buffer, buffer + count);
+
+    fclose(file);
+
+    uint32_t cycle = 0;
+    size_t pos = 0;
+
+    while (pos + 3 <= dump.size())
+    {
+        uint8_t reg = dump[pos++];
+        uint8_t value = dump[pos++];
+        uint32_t cycles = dump[pos++];
+
+        if (reg >> 5)
+        {
+            if (pos >= dump.size())
+                break;
+            cycles |= dump[pos++] << 8;
+        }
+
+        // The counter holds the cycles without a write, the write itself
+        // takes one more cycle.
+        cycle += cycles + 1;
+
+        SID_DUMP_WRITE write;
+        write.cycle = cycle;
+        write.address = reg & 0x1f;
+        write.value = value;
+        writes.push_back(write);
+    }
+
+    return !writes.empty();
+}
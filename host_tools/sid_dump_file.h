@@ -0,0 +1,36 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: sid_dump_file.h                       //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+#ifndef SID_DUMP_FILE_H
+#define SID_DUMP_FILE_H
+
+#include <stdint.h>
+#include <vector>
+
+// One register write of a SID dump.
+// cycle is the absolute SID cycle counted from the start of the dump.
+struct SID_DUMP_WRITE
+{
+    uint32_t cycle;
+    uint8_t  address;
+    uint8_t  value;
+};
+
+// Loads a complete Emu64 SID dump (*.sdp) or SID stream (*.sds, see
+// sid_stream_file.h) into writes.
+//
+// File format: "SID_DUMP" followed by one record per register write
+//   byte 0:   bit 0-4 register, bit 5 = long cycle counter
+//   byte 1:   value
+//   byte 2-3: cycles without a write before this write (8 or 16 bit)
+bool LoadSidDump(const char* filename, std::vector<SID_DUMP_WRITE>& writes);
+
+#endif // SID_DUMP_FILE_H
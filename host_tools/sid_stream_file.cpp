@@ -0,0 +1,418 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: sid_stream_file.cpp                   //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+#include "./sid_stream_file.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static void PutVarint(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((uint8_t)value);
+}
+
+static void Put32(uint8_t* out, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        out[i] = (uint8_t)(value >> (i * 8));
+}
+
+static void Put64(uint8_t* out, uint64_t value)
+{
+    for (int i = 0; i < 8; i++)
+        out[i] = (uint8_t)(value >> (i * 8));
+}
+
+static uint32_t Get32(const uint8_t* in)
+{
+    return in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static uint64_t Get64(const uint8_t* in)
+{
+    return Get32(in) | ((uint64_t)Get32(in + 4) << 32);
+}
+
+SID_STREAM_WRITER::SID_STREAM_WRITER()
+{
+    file = NULL;
+}
+
+SID_STREAM_WRITER::~SID_STREAM_WRITER()
+{
+    Close();
+}
+
+bool SID_STREAM_WRITER::Open(const char* filename, uint32_t frame_cycles)
+{
+    Close();
+
+    if (frame_cycles == 0)
+        return false;
+
+    file = fopen(filename, "wb");
+    if (file == NULL)
+        return false;
+
+    // Header is written by Close
+    uint8_t header[SID_STREAM_HEADER_SIZE] = {0};
+    fwrite(header, 1, SID_STREAM_HEADER_SIZE, file);
+
+    this->frame_cycles = frame_cycles;
+    write_count = 0;
+    last_cycle = 0;
+    offset = SID_STREAM_HEADER_SIZE;
+
+    last_frame = -1;
+    frame = 0;
+    frame_writes.clear();
+    frame_write_count = 0;
+
+    index_base.clear();
+    index_offset.clear();
+
+    return true;
+}
+
+bool SID_STREAM_WRITER::Write(uint64_t cycle, uint8_t address, uint8_t value)
+{
+    if (file == NULL || (write_count && cycle < last_cycle) || cycle > SID_STREAM_MAX_CYCLE)
+        return false;
+
+    const uint64_t write_frame = cycle / frame_cycles;
+
+    if (frame_write_count && write_frame != frame)
+        FlushFrame();
+
+    // The first write of a frame counts from the frame start
+    uint64_t previous = last_cycle;
+    if (frame_write_count == 0)
+    {
+        frame = write_frame;
+        previous = frame * frame_cycles;
+
+        // Seek point at the first frame of every SID_STREAM_INDEX_FRAMES,
+        // the reader knows no register values there
+        seek_point = last_frame < 0 || frame / SID_STREAM_INDEX_FRAMES != (uint64_t)last_frame / SID_STREAM_INDEX_FRAMES;
+        if (seek_point)
+        {
+            for (int i = 0; i < 32; i++)
+                this->value[i] = -1;
+        }
+    }
+
+    address &= 0x1f;
+    const bool same = this->value[address] == value;
+
+    PutVarint(frame_writes, (cycle - previous) << 6 | same << 5 | address);
+    if (!same)
+        frame_writes.push_back(value);
+    frame_write_count++;
+
+    this->value[address] = value;
+
+    last_cycle = cycle;
+    write_count++;
+    return true;
+}
+
+void SID_STREAM_WRITER::FlushFrame()
+{
+    const uint64_t base = last_frame + 1;
+
+    if (seek_point)
+    {
+        index_base.push_back((uint32_t)base);
+        index_offset.push_back(offset);
+    }
+
+    std::vector<uint8_t> head;
+    PutVarint(head, frame - base);
+    PutVarint(head, frame_write_count);
+
+    fwrite(head.data(), 1, head.size(), file);
+    fwrite(frame_writes.data(), 1, frame_writes.size(), file);
+    offset += head.size() + frame_writes.size();
+
+    last_frame = frame;
+    frame_writes.clear();
+    frame_write_count = 0;
+}
+
+bool SID_STREAM_WRITER::Close()
+{
+    if (file == NULL)
+        return false;
+
+    if (frame_write_count)
+        FlushFrame();
+
+    for (size_t i = 0; i < index_base.size(); i++)
+    {
+        uint8_t entry[12];
+        Put32(entry, index_base[i]);
+        Put64(entry + 4, index_offset[i]);
+        fwrite(entry, 1, sizeof(entry), file);
+    }
+
+    uint8_t header[SID_STREAM_HEADER_SIZE];
+    memcpy(header, SID_STREAM_ID, 8);
+    Put32(header + 8, frame_cycles);
+    Put32(header + 12, write_count);
+    Put64(header + 16, last_cycle);
+    Put64(header + 24, offset);
+    Put32(header + 32, (uint32_t)index_base.size());
+
+    fseek(file, 0, SEEK_SET);
+    fwrite(header, 1, SID_STREAM_HEADER_SIZE, file);
+
+    bool ok = !ferror(file);
+    ok = fclose(file) == 0 && ok;
+    file = NULL;
+
+    return ok;
+}
+
+SID_STREAM_READER::SID_STREAM_READER()
+{
+    data = NULL;
+    size = 0;
+}
+
+SID_STREAM_READER::~SID_STREAM_READER()
+{
+    Close();
+}
+
+bool SID_STREAM_READER::Open(const char* filename)
+{
+    Close();
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < SID_STREAM_HEADER_SIZE)
+    {
+        close(fd);
+        return false;
+    }
+
+    void* map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);		// The mapping stays valid
+
+    if (map == MAP_FAILED)
+        return false;
+
+    data = (const uint8_t*)map;
+    size = st.st_size;
+
+    const uint64_t index_offset = Get64(data + 24);
+
+    frame_cycles = Get32(data + 8);
+    write_count = Get32(data + 12);
+    end_cycle = Get64(data + 16);
+    index_count = Get32(data + 32);
+
+    if (memcmp(data, SID_STREAM_ID, 8) != 0 || frame_cycles == 0 || end_cycle > SID_STREAM_MAX_CYCLE ||
+        index_offset < SID_STREAM_HEADER_SIZE || index_offset > size ||
+        (size - index_offset) / 12 < index_count)
+    {
+        Close();
+        return false;
+    }
+
+    index = data + index_offset;
+    frames_end = index;
+
+    madvise(map, size, MADV_SEQUENTIAL);
+    Rewind();
+
+    return true;
+}
+
+void SID_STREAM_READER::Close()
+{
+    if (data)
+        munmap((void*)data, size);
+
+    data = NULL;
+    size = 0;
+}
+
+void SID_STREAM_READER::Rewind()
+{
+    pos = data + SID_STREAM_HEADER_SIZE;
+    frame_base = 0;
+    frame_left = 0;
+    cycle = 0;
+    memset(value, 0, sizeof(value));
+}
+
+bool SID_STREAM_READER::ReadVarint(uint64_t& value)
+{
+    value = 0;
+
+    for (int shift = 0; shift < 64 && pos < frames_end; shift += 7)
+    {
+        uint8_t byte = *pos++;
+        value |= (uint64_t)(byte & 0x7f) << shift;
+
+        if (!(byte & 0x80))
+            return true;
+    }
+
+    // Broken stream, ends here
+    pos = frames_end;
+    frame_left = 0;
+    return false;
+}
+
+bool SID_STREAM_READER::NextFrame()
+{
+    uint64_t skip, count;
+
+    if (!ReadVarint(skip) || !ReadVarint(count))
+        return false;
+
+    const uint64_t frame = frame_base + skip;
+    frame_base = frame + 1;
+    frame_left = count;
+    cycle = frame * frame_cycles;
+
+    return true;
+}
+
+bool SID_STREAM_READER::Next(SID_DUMP_WRITE& write)
+{
+    if (data == NULL)
+        return false;
+
+    while (frame_left == 0)
+    {
+        if (!NextFrame())
+            return false;
+    }
+
+    uint64_t delta;
+    if (!ReadVarint(delta))
+        return false;
+
+    const uint8_t address = delta & 0x1f;
+
+    if (!(delta & 0x20))
+    {
+        if (pos >= frames_end)
+        {
+            frame_left = 0;
+            return false;
+        }
+        value[address] = *pos++;
+    }
+
+    cycle += delta >> 6;
+    frame_left--;
+
+    // Broken stream beyond the header's end cycle
+    if (cycle > SID_STREAM_MAX_CYCLE)
+    {
+        pos = frames_end;
+        frame_left = 0;
+        return false;
+    }
+
+    write.cycle = (uint32_t)cycle;
+    write.address = address;
+    write.value = value[address];
+
+    return true;
+}
+
+void SID_STREAM_READER::Seek(uint64_t target)
+{
+    if (data == NULL)
+        return;
+
+    Rewind();
+
+    // Last seek point that starts at or before the target
+    uint32_t low = 0, high = index_count;
+    while (low < high)
+    {
+        uint32_t mid = (low + high) / 2;
+        if ((uint64_t)Get32(index + mid * 12) * frame_cycles <= target)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    if (low)
+    {
+        const uint8_t* entry = index + (low - 1) * 12;
+        const uint64_t frame_offset = Get64(entry + 4);
+
+        if (frame_offset >= SID_STREAM_HEADER_SIZE && frame_offset <= (uint64_t)(frames_end - data))
+        {
+            pos = data + frame_offset;
+            frame_base = Get32(entry);
+        }
+    }
+
+    // Skip up to the target
+    for (;;)
+    {
+        const uint8_t* last_pos = pos;
+        const uint64_t last_frame_base = frame_base;
+        const uint64_t last_frame_left = frame_left;
+        const uint64_t last_cycle = cycle;
+        uint8_t last_value[32];
+        memcpy(last_value, value, sizeof(value));
+
+        SID_DUMP_WRITE write;
+        if (!Next(write))
+            return;
+
+        if (cycle >= target)
+        {
+            pos = last_pos;
+            frame_base = last_frame_base;
+            frame_left = last_frame_left;
+            cycle = last_cycle;
+            memcpy(value, last_value, sizeof(value));
+            return;
+        }
+    }
+}
+
+bool SaveSidStream(const char* filename, const std::vector<SID_DUMP_WRITE>& writes, uint32_t frame_cycles)
+{
+    SID_STREAM_WRITER writer;
+
+    if (!writer.Open(filename, frame_cycles))
+        return false;
+
+    for (const SID_DUMP_WRITE& write : writes)
+    {
+        if (!writer.Write(write.cycle, write.address, write.value))
+            return false;
+    }
+
+    return writer.Close();
+}
@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: sid_stream_file.h                     //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+#ifndef SID_STREAM_FILE_H
+#define SID_STREAM_FILE_H
+
+#include <stdint.h>
+#include <cstdio>
+#include <vector>
+
+#include "./sid_dump_file.h"
+
+// SID stream dump (*.sds), the writes grouped in frames of frame_cycles
+// with varint cycle deltas and an index of seek points. A write of the
+// value the register already has since the last seek point (most of them)
+// has no value byte.
+//
+// Header (little endian, 36 bytes)
+//   0:  "SIDSTRM1"
+//   8:  uint32 cycles per frame
+//   12: uint32 number of writes
+//   16: uint64 cycle of the last write (at most SID_STREAM_MAX_CYCLE)
+//   24: uint64 file offset of the index
+//   32: uint32 number of index entries
+// Frames, only the ones with writes
+//   varint  frames without writes before this one
+//   varint  number of writes
+//   per write: varint (cycles after the previous write or the frame start) << 6 |
+//              same value << 5 | register, byte value if not the same value
+// Index, one entry per SID_STREAM_INDEX_FRAMES frames
+//   uint32 number of the frame before the entry + 1, uint64 file offset of the frame
+
+#define SID_STREAM_ID "SIDSTRM1"
+#define SID_STREAM_HEADER_SIZE 36
+#define SID_STREAM_FRAME_CYCLES 19656	// PAL: 312 lines * 63 cycles
+#define SID_STREAM_INDEX_FRAMES 50		// One seek point per second (PAL)
+#define SID_STREAM_MAX_CYCLE 0xffffffffu	// SID_DUMP_WRITE::cycle, ~72 minutes (PAL)
+
+class SID_STREAM_WRITER
+{
+public:
+    SID_STREAM_WRITER();
+    ~SID_STREAM_WRITER();
+
+    bool Open(const char* filename, uint32_t frame_cycles = SID_STREAM_FRAME_CYCLES);
+    // The cycles must not go backwards or beyond SID_STREAM_MAX_CYCLE
+    bool Write(uint64_t cycle, uint8_t address, uint8_t value);
+    // Writes the index and the header
+    bool Close();
+
+private:
+    void FlushFrame();
+
+    FILE* file;
+    uint32_t frame_cycles;
+    uint32_t write_count;
+    uint64_t last_cycle;
+    uint64_t offset;
+
+    int64_t  last_frame;		// Last written frame, -1 = none
+    uint64_t frame;				// Frame of the pending writes
+    std::vector<uint8_t> frame_writes;
+    uint32_t frame_write_count;
+    bool     seek_point;		// The frame gets an index entry
+
+    int      value[32];			// Since the last seek point, -1 = none
+
+    std::vector<uint32_t> index_base;
+    std::vector<uint64_t> index_offset;
+};
+
+// Zero copy reader, the file is mapped and decoded write by write
+class SID_STREAM_READER
+{
+public:
+    SID_STREAM_READER();
+    ~SID_STREAM_READER();
+
+    // Streams longer than SID_STREAM_MAX_CYCLE are rejected
+    bool Open(const char* filename);
+    void Close();
+
+    // Next write with its absolute cycle, false at the end
+    bool Next(SID_DUMP_WRITE& write);
+    // Next() returns the writes at or after cycle, the ones before are skipped
+    // from the last seek point on (not applied)
+    void Seek(uint64_t cycle);
+    void Rewind();
+
+    uint32_t FrameCycles();
+    uint32_t WriteCount();
+    uint64_t EndCycle();
+
+private:
+    bool ReadVarint(uint64_t& value);
+    bool NextFrame();
+
+    const uint8_t* data;
+    size_t size;
+
+    uint32_t frame_cycles;
+    uint32_t write_count;
+    uint64_t end_cycle;
+    const uint8_t* index;
+    uint32_t index_count;
+
+    const uint8_t* pos;
+    const uint8_t* frames_end;
+    uint64_t frame_base;		// Frame number of a skip of 0
+    uint64_t frame_left;		// Writes left in the frame
+    uint64_t cycle;
+    uint8_t  value[32];
+};
+
+inline uint32_t SID_STREAM_READER::FrameCycles()
+{
+    return frame_cycles;
+}
+
+inline uint32_t SID_STREAM_READER::WriteCount()
+{
+    return write_count;
+}
+
+inline uint64_t SID_STREAM_READER::EndCycle()
+{
+    return end_cycle;
+}
+
+// Writes a loaded dump as SID stream
+bool SaveSidStream(const char* filename, const std::vector<SID_DUMP_WRITE>& writes, uint32_t frame_cycles = SID_STREAM_FRAME_CYCLES);
+
+#endif // SID_STREAM_FILE_H
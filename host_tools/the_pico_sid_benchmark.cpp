@@ -0,0 +1,442 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: the_pico_sid_benchmark.cpp            //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+// Measures the emulated SID cycles per second of PICO_SID::Clock on the host.
+// Every SID dump is replayed for each combination of SID model, filter,
+// external filter and clocking step (delta_t). One audio sample is taken every
+// 24 cycles, just like pwm_irq_handle in the firmware does with 4 x Clock(6).
+// The checksum over all samples shows whether an engine change altered the
+// output.
+// With -b the samples are rendered with PICO_SID::ClockBlock in blocks of
+// BLOCK_SAMPLES, the writes are then applied at their exact cycle.
+// With -x every sample of the blocks goes through a SID_FRAME, voices and
+// filters clocked one after the other like SPLIT_CORES does on two cores.
+// The checksums have to be the same as with -b.
+// With -e the samples are clocked cycle exact by PICO_SID::ClockCycle (delta_t
+// is ignored), -e -x does the same through cycle exact frames.
+// With -R every sample is clocked in 4 steps that go through SID_RESAMPLER
+// (fast or FIR) like the firmware with SID_RESAMPLER_MODE, for its cost.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "pico_sid.h"
+#include "sid_dump_file.h"
+
+#define SID_CLOCK_PAL 985248
+#define CYCLES_PER_SAMPLE 24
+#define BLOCK_SAMPLES 256
+#define RESAMPLER_DECIMATION 4
+#define RESAMPLER_PASS_FREQ (SID_CLOCK_PAL / CYCLES_PER_SAMPLE * 0.4)
+
+struct BENCH_CONFIG
+{
+    sid_type model;
+    bool filter;
+    bool extfilter;
+    cycle_count delta_t;
+    bool block;
+    bool split;
+    bool exact;
+    resampler_mode resampler;
+};
+
+struct BENCH_RESULT
+{
+    double seconds;
+    uint32_t checksum;
+};
+
+// The firmware steps use PICO_SID::Clock<DELTA_T>
+static inline void ClockStep(PICO_SID* sid, cycle_count delta_t)
+{
+    switch (delta_t)
+    {
+    case 1: sid->Clock<1>(); break;
+    case 4: sid->Clock<4>(); break;
+    case 6: sid->Clock<6>(); break;
+    case 24: sid->Clock<24>(); break;
+    default: sid->Clock(delta_t); break;
+    }
+}
+
+template<cycle_count DELTA_T, bool CYCLE_EXACT = false>
+static void ClockFrameStep(PICO_SID* sid, SID_FRAME* frame, const SID_WRITE* writes, const SID_WRITE* writes_end)
+{
+    sid->ClockVoiceFrame<DELTA_T, CYCLE_EXACT>(CYCLES_PER_SAMPLE, writes, writes_end, frame);
+    sid->ClockFilterFrame<DELTA_T, CYCLE_EXACT>(frame);
+}
+
+// Same as ClockBlock, but each sample goes through a SID_FRAME
+static cycle_count ClockFrames(PICO_SID* sid, cycle_count delta_t, bool exact, uint16_t* buffer, const std::vector<SID_WRITE>& writes)
+{
+    SID_FRAME frame;
+    SID_WRITE sample_writes[CYCLES_PER_SAMPLE];
+    size_t pos = 0;
+
+    for (int i = 0; i < BLOCK_SAMPLES; i++)
+    {
+        const cycle_count sample_start = i * CYCLES_PER_SAMPLE;
+        int count = 0;
+
+        while (pos < writes.size() && writes[pos].cycle < sample_start + CYCLES_PER_SAMPLE)
+        {
+            sample_writes[count] = writes[pos++];
+            sample_writes[count].cycle = std::max(sample_writes[count].cycle - sample_start, 0);
+            count++;
+        }
+
+        if (exact)
+            ClockFrameStep<1, true>(sid, &frame, sample_writes, sample_writes + count);
+        else switch (delta_t)
+        {
+        case 1: ClockFrameStep<1>(sid, &frame, sample_writes, sample_writes + count); break;
+        case 4: ClockFrameStep<4>(sid, &frame, sample_writes, sample_writes + count); break;
+        case 6: ClockFrameStep<6>(sid, &frame, sample_writes, sample_writes + count); break;
+        default: ClockFrameStep<24>(sid, &frame, sample_writes, sample_writes + count); break;
+        }
+
+        buffer[i] = sid->ResampledOut(11) + 1024;
+    }
+
+    return BLOCK_SAMPLES * CYCLES_PER_SAMPLE;
+}
+
+// Same as ClockBlock, cycle exact
+static cycle_count ClockCycles(PICO_SID* sid, uint16_t* buffer, const std::vector<SID_WRITE>& writes)
+{
+    const SID_WRITE* write = writes.data();
+    const SID_WRITE* writes_end = write + writes.size();
+    cycle_count cycle = 0;
+
+    for (int i = 0; i < BLOCK_SAMPLES; i++)
+    {
+        sid->ClockSampleCycles(cycle, cycle + CYCLES_PER_SAMPLE, write, writes_end);
+        buffer[i] = sid->AudioOut(11) + 1024;
+    }
+
+    return cycle;
+}
+
+static BENCH_RESULT RunBenchmark(const std::vector<SID_DUMP_WRITE>& writes, const BENCH_CONFIG& config, uint32_t cycles)
+{
+    PICO_SID* sid = new PICO_SID();
+
+    sid->SetSidType(config.model);
+    sid->EnableFilter(config.filter);
+    sid->EnableExtFilter(config.extfilter);
+    sid->SetupResampler(config.resampler, CYCLES_PER_SAMPLE, RESAMPLER_DECIMATION, SID_CLOCK_PAL, RESAMPLER_PASS_FREQ);
+
+    for (int i = 0; i < 32; i++)
+        sid->WriteReg(i, 0);
+
+    const uint32_t dump_length = writes.back().cycle;
+
+    uint32_t checksum = 2166136261u;	// FNV-1a
+    uint32_t cycle = 0;
+    uint32_t dump_start = 0;
+    uint32_t next_sample = CYCLES_PER_SAMPLE;
+    size_t pos = 0;
+
+    std::vector<SID_WRITE> block_writes;
+    uint16_t block_buffer[BLOCK_SAMPLES];
+
+    auto start = std::chrono::steady_clock::now();
+
+    while (config.block && cycle < cycles)
+    {
+        const uint32_t block_end = cycle + BLOCK_SAMPLES * CYCLES_PER_SAMPLE;
+
+        block_writes.clear();
+        while (writes[pos].cycle + dump_start < block_end)
+        {
+            SID_WRITE write;
+            write.cycle = writes[pos].cycle + dump_start - cycle;
+            write.address = writes[pos].address;
+            write.value = writes[pos].value;
+            block_writes.push_back(write);
+
+            if (++pos == writes.size())
+            {
+                pos = 0;
+                dump_start += dump_length;
+            }
+        }
+
+        if (config.split)
+            cycle += ClockFrames(sid, config.delta_t, config.exact, block_buffer, block_writes);
+        else if (config.exact)
+            cycle += ClockCycles(sid, block_buffer, block_writes);
+        else
+            cycle += sid->ClockBlock(CYCLES_PER_SAMPLE, config.delta_t, block_buffer, BLOCK_SAMPLES, 11, block_writes.data(), block_writes.size());
+
+        for (int i = 0; i < BLOCK_SAMPLES; i++)
+            checksum = (checksum ^ (uint16_t)(block_buffer[i] - 1024)) * 16777619u;
+    }
+
+    while (!config.block && cycle < cycles)
+    {
+        // Writes are applied on the delta_t grid, as in the firmware.
+        while (writes[pos].cycle + dump_start <= cycle)
+        {
+            sid->WriteReg(writes[pos].address, writes[pos].value);
+
+            if (++pos == writes.size())
+            {
+                // Start the dump again.
+                pos = 0;
+                dump_start += dump_length;
+            }
+        }
+
+        ClockStep(sid, config.delta_t);
+        cycle += config.delta_t;
+
+        while (cycle >= next_sample)
+        {
+            checksum = (checksum ^ (uint16_t)sid->AudioOut(11)) * 16777619u;
+            next_sample += CYCLES_PER_SAMPLE;
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    delete sid;
+
+    BENCH_RESULT result;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.checksum = checksum;
+    return result;
+}
+
+static void Usage(const char* name)
+{
+    printf("Usage: %s [options] [dump.sdp|dump.sds ...]\n", name);
+    printf("  -s <seconds>    emulated seconds per run (default 1)\n");
+    printf("  -r <count>      repeats per run, the fastest one counts (default 3)\n");
+    printf("  -d <list>       clocking steps delta_t (default 1,4,6,24)\n");
+    printf("  -m <6581|8580>  only this SID model\n");
+    printf("  -b              render with PICO_SID::ClockBlock\n");
+    printf("  -x              render with ClockVoiceFrame / ClockFilterFrame (delta_t 1, 4, 6, 24)\n");
+    printf("  -e              clock cycle exact with PICO_SID::ClockCycle (delta_t 1 only)\n");
+    printf("  -R <fast|fir>   with -b or -x: resample %d steps per sample to the output rate\n", RESAMPLER_DECIMATION);
+    printf("  -h              this help\n");
+    printf("Without dumps all *.sdp / *.sds files from %s are used.\n", SID_DUMP_DEMOS_DIR);
+}
+
+int main(int argc, char* argv[])
+{
+    double seconds = 1.0;
+    int repeats = 3;
+    std::vector<cycle_count> deltas = {1, 4, 6, 24};
+    std::vector<sid_type> models = {MOS_6581, MOS_8580};
+    std::vector<std::string> files;
+    bool block = false;
+    bool split = false;
+    bool exact = false;
+    resampler_mode resampler = RESAMPLER_OFF;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (!strcmp(arg, "-h"))
+        {
+            Usage(argv[0]);
+            return 0;
+        }
+        else if (!strcmp(arg, "-b"))
+            block = true;
+        else if (!strcmp(arg, "-x"))
+            block = split = true;
+        else if (!strcmp(arg, "-e"))
+            block = exact = true;
+        else if (arg[0] == '-' && value == NULL)
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+        else if (!strcmp(arg, "-s"))
+        {
+            seconds = atof(value);
+            i++;
+        }
+        else if (!strcmp(arg, "-r"))
+        {
+            repeats = atoi(value);
+            i++;
+        }
+        else if (!strcmp(arg, "-d"))
+        {
+            deltas.clear();
+            for (const char* p = value; *p; )
+            {
+                cycle_count delta_t = (cycle_count)strtol(p, (char**)&p, 10);
+                if (delta_t > 0)
+                    deltas.push_back(delta_t);
+                if (*p)
+                    p++;
+            }
+            i++;
+        }
+        else if (!strcmp(arg, "-R"))
+        {
+            if (!strcmp(value, "fast"))
+                resampler = RESAMPLER_FAST;
+            else if (!strcmp(value, "fir"))
+                resampler = RESAMPLER_FIR;
+            else
+            {
+                Usage(argv[0]);
+                return 1;
+            }
+            i++;
+        }
+        else if (!strcmp(arg, "-m"))
+        {
+            models.clear();
+            models.push_back(atoi(value) == 8580 ? MOS_8580 : MOS_6581);
+            i++;
+        }
+        else if (arg[0] == '-')
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+        else
+            files.push_back(arg);
+    }
+
+    if (files.empty())
+    {
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(SID_DUMP_DEMOS_DIR, error))
+        {
+            if (entry.path().extension() == ".sdp" || entry.path().extension() == ".sds")
+                files.push_back(entry.path().string());
+        }
+        std::sort(files.begin(), files.end());
+    }
+
+    if (files.empty() || deltas.empty() || seconds <= 0 || repeats < 1)
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    // ClockSampleCycles has no resampler steps
+    if (resampler != RESAMPLER_OFF && (!block || (exact && !split)))
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    if (exact)
+        deltas = {1};
+
+    for (cycle_count delta_t : deltas)
+    {
+        if (split && delta_t != 1 && delta_t != 4 && delta_t != 6 && delta_t != 24)
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    const uint32_t cycles = (uint32_t)(seconds * SID_CLOCK_PAL);
+
+    if (exact)
+        printf("Rendering cycle exact with %s, %d samples per block\n\n", split ? "cycle exact frames" : "ClockCycle", BLOCK_SAMPLES);
+    else if (split)
+        printf("Rendering with ClockVoiceFrame / ClockFilterFrame, %d samples per block\n\n", BLOCK_SAMPLES);
+    else if (block)
+        printf("Rendering with ClockBlock, %d samples per block\n\n", BLOCK_SAMPLES);
+
+    if (resampler != RESAMPLER_OFF)
+    {
+        SID_RESAMPLER taps;
+        taps.Setup(resampler, RESAMPLER_DECIMATION, SID_CLOCK_PAL * RESAMPLER_DECIMATION / (double)CYCLES_PER_SAMPLE, RESAMPLER_PASS_FREQ);
+        printf("Resampler %s: %d steps per sample, %d taps\n\n", resampler == RESAMPLER_FIR ? "FIR" : "fast", RESAMPLER_DECIMATION, taps.Taps());
+    }
+
+    printf("%-32s %-5s %-6s %-9s %5s %12s %11s %9s %10s\n",
+           "dump", "model", "filter", "extfilter", "dt", "cycles/s", "ns/sample", "realtime", "checksum");
+
+    double total_seconds = 0;
+    double total_cycles = 0;
+
+    for (const std::string& file : files)
+    {
+        std::vector<SID_DUMP_WRITE> writes;
+        if (!LoadSidDump(file.c_str(), writes))
+        {
+            fprintf(stderr, "Error: %s is not a valid SID dump.\n", file.c_str());
+            continue;
+        }
+
+        std::string name = std::filesystem::path(file).filename().string();
+        if (name.size() > 32)
+            name = name.substr(0, 29) + "...";
+
+        for (sid_type model : models)
+        for (int filter = 1; filter >= 0; filter--)
+        for (int extfilter = 1; extfilter >= 0; extfilter--)
+        for (cycle_count delta_t : deltas)
+        {
+            BENCH_CONFIG config;
+            config.model = model;
+            config.filter = filter;
+            config.extfilter = extfilter;
+            config.delta_t = delta_t;
+            config.block = block;
+            config.split = split;
+            config.exact = exact;
+            config.resampler = resampler;
+
+            BENCH_RESULT best = RunBenchmark(writes, config, cycles);
+            for (int r = 1; r < repeats; r++)
+            {
+                BENCH_RESULT result = RunBenchmark(writes, config, cycles);
+                if (result.seconds < best.seconds)
+                    best = result;
+            }
+
+            const double cycles_per_second = cycles / best.seconds;
+            const double ns_per_sample = best.seconds * 1e9 / (cycles / (double)CYCLES_PER_SAMPLE);
+
+            printf("%-32s %-5s %-6s %-9s %5d %12.0f %11.1f %8.1fx   %08x\n",
+                   name.c_str(),
+                   model == MOS_6581 ? "6581" : "8580",
+                   filter ? "on" : "off",
+                   extfilter ? "on" : "off",
+                   delta_t,
+                   cycles_per_second,
+                   ns_per_sample,
+                   cycles_per_second / SID_CLOCK_PAL,
+                   best.checksum);
+
+            total_seconds += best.seconds;
+            total_cycles += cycles;
+        }
+    }
+
+    if (total_seconds > 0)
+        printf("\nTotal: %.0f cycles/s over all runs\n", total_cycles / total_seconds);
+
+    return 0;
+}
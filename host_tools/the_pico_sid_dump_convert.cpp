@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: the_pico_sid_dump_convert.cpp         //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+// Converts an Emu64 SID dump (*.sdp) into a SID stream (*.sds).
+// The stream is read back through SID_STREAM_READER (mmap) and compared
+// write by write, a seek into the middle is checked as well.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+
+#include "sid_dump_file.h"
+#include "sid_stream_file.h"
+
+static long FileSize(const char* filename)
+{
+    struct stat st;
+    return stat(filename, &st) == 0 ? (long)st.st_size : -1;
+}
+
+static bool Verify(const char* filename, const std::vector<SID_DUMP_WRITE>& writes)
+{
+    SID_STREAM_READER stream;
+    if (!stream.Open(filename) || stream.WriteCount() != writes.size())
+        return false;
+
+    SID_DUMP_WRITE write;
+    for (const SID_DUMP_WRITE& expected : writes)
+    {
+        if (!stream.Next(write) || write.cycle != expected.cycle ||
+            write.address != expected.address || write.value != expected.value)
+            return false;
+    }
+
+    if (stream.Next(write))
+        return false;
+
+    // First write at or behind the middle
+    const SID_DUMP_WRITE& middle = writes[writes.size() / 2];
+    size_t i = writes.size() / 2;
+    while (i > 0 && writes[i - 1].cycle == middle.cycle)
+        i--;
+
+    stream.Seek(middle.cycle);
+    return stream.Next(write) && write.cycle == writes[i].cycle &&
+           write.address == writes[i].address && write.value == writes[i].value;
+}
+
+static void Usage(const char* name)
+{
+    printf("Usage: %s [options] dump.sdp stream.sds\n", name);
+    printf("  -f <cycles>     cycles per frame (default %d, PAL)\n", SID_STREAM_FRAME_CYCLES);
+    printf("  -h              this help\n");
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t frame_cycles = SID_STREAM_FRAME_CYCLES;
+    const char* files[2];
+    int file_count = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+
+        if (!strcmp(arg, "-h"))
+        {
+            Usage(argv[0]);
+            return 0;
+        }
+        else if (!strcmp(arg, "-f") && i + 1 < argc)
+        {
+            frame_cycles = (uint32_t)atol(argv[++i]);
+        }
+        else if (arg[0] != '-' && file_count < 2)
+            files[file_count++] = arg;
+        else
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (file_count != 2 || frame_cycles == 0)
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<SID_DUMP_WRITE> writes;
+    if (!LoadSidDump(files[0], writes))
+    {
+        fprintf(stderr, "Error: %s is not a valid SID dump.\n", files[0]);
+        return 1;
+    }
+
+    if (!SaveSidStream(files[1], writes, frame_cycles))
+    {
+        fprintf(stderr, "Error: %s could not be written.\n", files[1]);
+        return 1;
+    }
+
+    if (!Verify(files[1], writes))
+    {
+        fprintf(stderr, "Error: %s does not read back the same writes.\n", files[1]);
+        return 1;
+    }
+
+    const long in_size = FileSize(files[0]);
+    const long out_size = FileSize(files[1]);
+
+    printf("%s: %zu writes, %u cycles\n", files[1], writes.size(), writes.back().cycle);
+    printf("%ld -> %ld bytes (%.2f -> %.2f bytes per write)\n",
+           in_size, out_size, in_size / (double)writes.size(), out_size / (double)writes.size());
+
+    return 0;
+}
@@ -0,0 +1,398 @@
+//////////////////////////////////////////////////
+//                                              //
+// ThePicoSID                                   //
+// von Thorsten Kattanek                        //
+//                                              //
+// #file: the_pico_sid_render.cpp               //
+//                                              //
+// https://github.com/ThKattanek/the_pico_sid   //
+//                                              //
+//////////////////////////////////////////////////
+
+// Renders SID dumps (*.sdp / *.sds) offline to WAV or raw PCM (16 bit
+// signed, mono) as fast as the host can clock the engine. The writes are
+// applied at their exact cycle, the samples are taken at the given sample
+// rate from the PAL clock (fractional cycles per sample).
+// The dumps are rendered in parallel by a pool of threads, each one with its
+// own PICO_SID. The shared tables are built once before the threads start.
+// A stream (*.sds) is decoded from its mapping block by block while rendering,
+// only the small *.sdp dumps are loaded completely.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pico_sid.h"
+#include "sid_dump_file.h"
+#include "sid_stream_file.h"
+
+#define SID_CLOCK_PAL 985248
+#define BLOCK_SAMPLES 4096
+
+struct RENDER_CONFIG
+{
+    sid_type model;
+    bool filter;
+    bool extfilter;
+    bool digi_boost;
+    cycle_count delta_t;
+    uint32_t sample_rate;
+    double seconds;		// 0 = length of the dump
+    bool raw;
+    std::string output_dir;
+};
+
+struct RENDER_RESULT
+{
+    bool ok;
+    double audio;		// Seconds of audio
+    double seconds;		// Render time
+};
+
+static void Put16(FILE* file, uint16_t value)
+{
+    uint8_t bytes[2] = {(uint8_t)value, (uint8_t)(value >> 8)};
+    fwrite(bytes, 1, 2, file);
+}
+
+static void Put32(FILE* file, uint32_t value)
+{
+    Put16(file, (uint16_t)value);
+    Put16(file, (uint16_t)(value >> 16));
+}
+
+// 44 byte RIFF header, 16 bit mono PCM
+static void WriteWavHeader(FILE* file, uint32_t sample_rate, uint32_t samples)
+{
+    const uint32_t data_size = samples * 2;
+
+    fwrite("RIFF", 1, 4, file);
+    Put32(file, 36 + data_size);
+    fwrite("WAVEfmt ", 1, 8, file);
+    Put32(file, 16);
+    Put16(file, 1);					// PCM
+    Put16(file, 1);					// Mono
+    Put32(file, sample_rate);
+    Put32(file, sample_rate * 2);	// Bytes per second
+    Put16(file, 2);					// Bytes per frame
+    Put16(file, 16);
+    fwrite("data", 1, 4, file);
+    Put32(file, data_size);
+}
+
+// Writes of a dump in cycle order
+class DUMP_SOURCE
+{
+public:
+    bool Open(const char* filename)
+    {
+        pos = 0;
+        writes.clear();
+
+        is_stream = stream.Open(filename);
+        if (is_stream)
+            return stream.WriteCount() > 0;
+
+        return LoadSidDump(filename, writes);
+    }
+
+    bool Next(SID_DUMP_WRITE& write)
+    {
+        if (is_stream)
+            return stream.Next(write);
+
+        if (pos >= writes.size())
+            return false;
+
+        write = writes[pos++];
+        return true;
+    }
+
+    uint64_t EndCycle()
+    {
+        return is_stream ? stream.EndCycle() : writes.back().cycle;
+    }
+
+private:
+    bool is_stream;
+    SID_STREAM_READER stream;
+    std::vector<SID_DUMP_WRITE> writes;
+    size_t pos;
+};
+
+// Returns the rendered samples, -1 on error
+static int64_t RenderDump(DUMP_SOURCE& source, const RENDER_CONFIG& config, FILE* file)
+{
+    PICO_SID* sid = new PICO_SID();
+
+    sid->SetSidType(config.model);
+    sid->EnableFilter(config.filter);
+    sid->EnableExtFilter(config.extfilter);
+    sid->EnableDigiBoost8580(config.digi_boost);
+
+    for (int i = 0; i < 32; i++)
+        sid->WriteReg(i, 0);
+
+    const uint64_t cycles = config.seconds > 0 ? (uint64_t)(config.seconds * SID_CLOCK_PAL) : source.EndCycle();
+    const uint64_t samples = cycles * config.sample_rate / SID_CLOCK_PAL;
+
+    std::vector<SID_WRITE> block_writes;
+    int16_t buffer[BLOCK_SAMPLES];
+    uint64_t sample = 0;
+
+    SID_DUMP_WRITE next;
+    bool next_valid = source.Next(next);
+
+    while (sample < samples)
+    {
+        const int count = (int)std::min<uint64_t>(BLOCK_SAMPLES, samples - sample);
+        const uint64_t block_start = sample * SID_CLOCK_PAL / config.sample_rate;
+        const uint64_t block_end = (sample + count) * SID_CLOCK_PAL / config.sample_rate;
+
+        block_writes.clear();
+        while (next_valid && next.cycle < block_end)
+        {
+            SID_WRITE write;
+            write.cycle = (cycle_count)(next.cycle - std::min<uint64_t>(next.cycle, block_start));
+            write.address = next.address;
+            write.value = next.value;
+            block_writes.push_back(write);
+            next_valid = source.Next(next);
+        }
+
+        const SID_WRITE* write = block_writes.data();
+        const SID_WRITE* writes_end = write + block_writes.size();
+        cycle_count cycle = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            const cycle_count sample_end = (cycle_count)((sample + i + 1) * SID_CLOCK_PAL / config.sample_rate - block_start);
+            sid->ClockSample(cycle, sample_end, config.delta_t, write, writes_end);
+            buffer[i] = sid->AudioOut(16);
+        }
+
+        // Little endian host
+        if (fwrite(buffer, 2, count, file) != (size_t)count)
+        {
+            delete sid;
+            return -1;
+        }
+
+        sample += count;
+    }
+
+    delete sid;
+    return samples;
+}
+
+static RENDER_RESULT RenderFile(const std::string& file, const RENDER_CONFIG& config, std::string& output)
+{
+    RENDER_RESULT result = {false, 0, 0};
+
+    output = (std::filesystem::path(config.output_dir) /
+              std::filesystem::path(file).stem()).string() + (config.raw ? ".raw" : ".wav");
+
+    auto start = std::chrono::steady_clock::now();
+
+    DUMP_SOURCE source;
+    if (!source.Open(file.c_str()))
+    {
+        fprintf(stderr, "Error: %s is not a valid SID dump.\n", file.c_str());
+        return result;
+    }
+
+    FILE* out = fopen(output.c_str(), "wb");
+    if (out == NULL)
+    {
+        fprintf(stderr, "Error: %s could not be created.\n", output.c_str());
+        return result;
+    }
+
+    // The sample count is known after rendering
+    if (!config.raw)
+        WriteWavHeader(out, config.sample_rate, 0);
+
+    int64_t samples = RenderDump(source, config, out);
+
+    if (samples >= 0 && !config.raw)
+    {
+        fseek(out, 0, SEEK_SET);
+        WriteWavHeader(out, config.sample_rate, (uint32_t)samples);
+    }
+
+    if (fclose(out) != 0 || samples < 0)
+    {
+        fprintf(stderr, "Error: %s could not be written.\n", output.c_str());
+        return result;
+    }
+
+    result.ok = true;
+    result.audio = samples / (double)config.sample_rate;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+static void Usage(const char* name)
+{
+    printf("Usage: %s [options] dump.sdp|dump.sds ...\n", name);
+    printf("  -m <6581|8580>  SID model (default 6581)\n");
+    printf("  -F              filter off\n");
+    printf("  -E              external filter off\n");
+    printf("  -B              digi boost (8580)\n");
+    printf("  -d <delta_t>    clocking step in cycles (default 1)\n");
+    printf("  -r <rate>       sample rate (default 44100)\n");
+    printf("  -s <seconds>    render length (default the length of the dump)\n");
+    printf("  -p              raw PCM (16 bit signed, little endian, mono) instead of WAV\n");
+    printf("  -o <dir>        output directory (default .)\n");
+    printf("  -j <threads>    dumps rendered in parallel (default all cores)\n");
+    printf("  -h              this help\n");
+    printf("Every dump is rendered to <dir>/<name>.wav (.raw with -p).\n");
+}
+
+int main(int argc, char* argv[])
+{
+    RENDER_CONFIG config;
+    config.model = MOS_6581;
+    config.filter = true;
+    config.extfilter = true;
+    config.digi_boost = false;
+    config.delta_t = 1;
+    config.sample_rate = 44100;
+    config.seconds = 0;
+    config.raw = false;
+    config.output_dir = ".";
+
+    int threads = (int)std::thread::hardware_concurrency();
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (!strcmp(arg, "-h"))
+        {
+            Usage(argv[0]);
+            return 0;
+        }
+        else if (!strcmp(arg, "-F"))
+            config.filter = false;
+        else if (!strcmp(arg, "-E"))
+            config.extfilter = false;
+        else if (!strcmp(arg, "-B"))
+            config.digi_boost = true;
+        else if (!strcmp(arg, "-p"))
+            config.raw = true;
+        else if (arg[0] == '-' && value == NULL)
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+        else if (!strcmp(arg, "-m"))
+        {
+            config.model = atoi(value) == 8580 ? MOS_8580 : MOS_6581;
+            i++;
+        }
+        else if (!strcmp(arg, "-d"))
+        {
+            config.delta_t = atoi(value);
+            i++;
+        }
+        else if (!strcmp(arg, "-r"))
+        {
+            config.sample_rate = (uint32_t)atol(value);
+            i++;
+        }
+        else if (!strcmp(arg, "-s"))
+        {
+            config.seconds = atof(value);
+            i++;
+        }
+        else if (!strcmp(arg, "-o"))
+        {
+            config.output_dir = value;
+            i++;
+        }
+        else if (!strcmp(arg, "-j"))
+        {
+            threads = atoi(value);
+            i++;
+        }
+        else if (arg[0] == '-')
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+        else
+            files.push_back(arg);
+    }
+
+    // One sample has to be at least one cycle
+    if (files.empty() || config.delta_t < 1 || config.sample_rate < 1000 || config.sample_rate > SID_CLOCK_PAL || config.seconds < 0)
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    threads = std::max(1, std::min(threads, (int)files.size()));
+
+    // The constructors must not build the merged wave tables on the threads
+    PICO_SID::ClassInit();
+
+    std::atomic<size_t> next_file(0);
+    std::mutex print_mutex;
+    double total_seconds = 0;
+    double total_audio = 0;
+    int errors = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    auto worker = [&]()
+    {
+        size_t i;
+        while ((i = next_file++) < files.size())
+        {
+            std::string output;
+            RENDER_RESULT result = RenderFile(files[i], config, output);
+
+            std::lock_guard<std::mutex> lock(print_mutex);
+            if (!result.ok)
+            {
+                errors++;
+                continue;
+            }
+
+            printf("%-40s %8.1f s audio %8.2f s %8.1fx realtime\n",
+                   output.c_str(), result.audio, result.seconds, result.audio / result.seconds);
+            fflush(stdout);
+
+            total_seconds += result.seconds;
+            total_audio += result.audio;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; t++)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread& thread : pool)
+        thread.join();
+
+    const double wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (total_seconds > 0)
+    {
+        printf("\nTotal: %.1f s audio in %.2f s on %d threads, %.1fx realtime (%.1fx per thread)\n",
+               total_audio, wall_seconds, threads, total_audio / wall_seconds, total_audio / total_seconds);
+    }
+
+    return errors ? 1 : 0;
+}
@@ -135,7 +135,6 @@ MainWindow::~MainWindow()
 void MainWindow::OnFillAudioData(char *data, qint64 len)
 {
     float* buffer = reinterpret_cast<float*>(data);
-    int buffer_pos = 0;
 
     static unsigned short wave0_buffer[SOUND_BUFFER_SIZE];
     static unsigned short wave1_buffer[SOUND_BUFFER_SIZE];
@@ -145,70 +144,62 @@ void MainWindow::OnFillAudioData(char *data, qint64 len)
     static unsigned short env1_buffer[SOUND_BUFFER_SIZE];
     static unsigned short env2_buffer[SOUND_BUFFER_SIZE];
 
-    int wave_pos = 0;
+    static SID_SCOPE_BUFFER scope = {{wave0_buffer, wave1_buffer, wave2_buffer}, {env0_buffer, env1_buffer, env2_buffer}};
 
-    while(buffer_pos < (len / (m_format.sampleSize()/8)))
+    cycle_count delta_t;
+    if(cycle_excact_sid)
+        delta_t = 1;
+    else if(!sid.extfilter_enable)
+        delta_t = 4;
+    else
+        delta_t = 6;
+
+    // Stereo, 24 cycles per sample
+    int samples_left = (len / (m_format.sampleSize()/8)) / 2;
+    int samples = 0;
+
+    sid.SetScopeBuffer(&scope);
+
+    while(samples_left > 0)
     {
-        if(!cycle_excact_sid)
-        {
-            if(!sid.extfilter_enable)
-            {
-                for(int i=0; i<6; i++)
-                {
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    sid.Clock(4);
-                }
-            }
-            else
-            {
-                for(int i=0; i<4; i++)
-                {
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                    sid.Clock(6);
-                }
-            }
-        }
-        else
+        samples = samples_left;
+        if(samples > SOUND_BUFFER_SIZE)
+            samples = SOUND_BUFFER_SIZE;
+
+        // Collect the register writes of the whole block
+        sid_writes.clear();
+        for(int cycle=0; cycle<samples*24; cycle++)
         {
-            for(int i=0; i<24; i++)
+            if(sid_dump->CycleTickPlay())
             {
-                if(sid_dump->CycleTickPlay()) sid.WriteReg(sid_dump->RegOut, sid_dump->RegWertOut);
-                sid.Clock(1);
+                SID_WRITE write;
+                write.cycle = cycle;
+                write.address = sid_dump->RegOut;
+                write.value = sid_dump->RegWertOut;
+                sid_writes.push_back(write);
             }
         }
 
-        buffer[buffer_pos] = buffer[buffer_pos+1] = ((sid.AudioOut()) + 32768) / (float)0xffff;
-
-        // Osc Waves Visualisieren
-        wave0_buffer[wave_pos] = sid.voice[0].wave.Output();
-        wave1_buffer[wave_pos] = sid.voice[1].wave.Output();
-        wave2_buffer[wave_pos] = sid.voice[2].wave.Output();
+        sid.ClockBlock(24, delta_t, sample_buffer, samples, sid_writes.data(), sid_writes.size());
 
-        // Env Waves Visualisieren
-        env0_buffer[wave_pos] = sid.voice[0].envelope.Output();
-        env1_buffer[wave_pos] = sid.voice[1].envelope.Output();
-        env2_buffer[wave_pos] = sid.voice[2].envelope.Output();
-
-        wave_pos++;
+        for(int i=0; i<samples; i++)
+        {
+            buffer[i*2] = buffer[i*2+1] = (sample_buffer[i] + 32768) / (float)0xffff;
+        }
 
-        buffer_pos += 2;
+        buffer += samples * 2;
+        samples_left -= samples;
     }
 
-    ui->osc1->NextAudioData((unsigned char*)wave0_buffer, wave_pos, 12, false);
-    ui->osc2->NextAudioData((unsigned char*)wave1_buffer, wave_pos, 12, false);
-    ui->osc3->NextAudioData((unsigned char*)wave2_buffer, wave_pos, 12, false);
+    sid.SetScopeBuffer(0);
+
+    ui->osc1->NextAudioData((unsigned char*)wave0_buffer, samples, 12, false);
+    ui->osc2->NextAudioData((unsigned char*)wave1_buffer, samples, 12, false);
+    ui->osc3->NextAudioData((unsigned char*)wave2_buffer, samples, 12, false);
 
-    ui->env1->NextAudioData((unsigned char*)env0_buffer, wave_pos, 8, false);
-    ui->env2->NextAudioData((unsigned char*)env1_buffer, wave_pos, 8, false);
-    ui->env3->NextAudioData((unsigned char*)env2_buffer, wave_pos, 8, false);
+    ui->env1->NextAudioData((unsigned char*)env0_buffer, samples, 8, false);
+    ui->env2->NextAudioData((unsigned char*)env1_buffer, samples, 8, false);
+    ui->env3->NextAudioData((unsigned char*)env2_buffer, samples, 8, false);
 }
 
 void MainWindow::on_Quit_clicked()
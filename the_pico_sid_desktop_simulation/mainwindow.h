@@ -8,6 +8,8 @@
 #include <QAudioDeviceInfo>
 #include <QAudioOutput>
 
+#include <vector>
+
 #include "siddump.h"
 
 
@@ -55,6 +57,9 @@ private:
 
     PICO_SID         sid;
 
+    std::vector<SID_WRITE> sid_writes;
+    short           sample_buffer[SOUND_BUFFER_SIZE];
+
     uint8_t         sid_io[32];
     SIDDumpClass*   sid_dump;
     uint8_t         sid_dump_io;
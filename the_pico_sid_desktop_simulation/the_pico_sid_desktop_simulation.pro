@@ -34,9 +34,9 @@ SOURCES += \
     ../firmware/sid_voice.cpp \
     ../firmware/sid_wave.cpp \
     ../firmware/sid_envelope.cpp \
-    ../firmware/sid_dac.cpp \
     ../firmware/sid_filter.cpp \
-    ../firmware/sid_extfilter.cpp
+    ../firmware/sid_extfilter.cpp \
+    ../firmware/sid_resampler.cpp
 
 HEADERS += \
     ../firmware/pico_sid.h \
@@ -47,6 +47,7 @@ HEADERS += \
     ../firmware/sid_dac.h \
     ../firmware/sid_filter.h \
     ../firmware/sid_extfilter.h \
+    ../firmware/sid_resampler.h \
     ../firmware/version.h
 
 FORMS += \